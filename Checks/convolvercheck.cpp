@@ -0,0 +1,104 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Check File:  convolvercheck.cpp
+//
+/**
+    \file   convolvercheck.cpp
+    \author Christian George
+    \date   19-October-2026
+    \brief  standalone check of PartitionedConvolver against a direct form convolution while the
+            impulse response is swapped between lengths, including shrinking it to the head only
+
+    Noise is run through the convolver while a list of impulse responses is loaded one after the
+    other. After each load the output is compared with a direct form convolution of the same input
+    and IR, once the blocks already in flight have been flushed (one block per new tail partition,
+    plus the block in progress). The check fails if any error exceeds CHECK_TOLERANCE.
+
+    Build and run from the repository root (fxobjects.cpp is compiled in; needs FFTW 3):
+    g++ -std=c++14 -O2 -DHAVE_FFTW -IPluginKernel -IPluginObjects -ICustomControls Checks/convolvercheck.cpp -lfftw3 -o convolvercheck
+    ./convolvercheck
+
+    The process exits with 0 when every segment passes, 1 otherwise.
+*/
+// -----------------------------------------------------------------------------
+// --- the plugin projects get these through their precompiled headers
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include <vector>
+
+// --- one translation unit, so the check builds with a single command line
+#include "fxobjects.cpp"
+
+#ifndef HAVE_FFTW
+#error convolvercheck needs HAVE_FFTW (PartitionedConvolver is an FFTW object)
+#endif
+
+const unsigned int CHECK_MAX_IR_LEN = 1024;
+const unsigned int CHECK_SEGMENT_LEN = 4133;	///< samples run with each IR; not a whole number of blocks
+const double CHECK_TOLERANCE = 1.0e-9;
+
+int main()
+{
+	// --- grow, shrink within the tail, shrink to the head only (from short and long tails),
+	//     back out of head only, and exactly one partition
+	const unsigned int irLengths[] = { 300, 10, 1024, 10, 700, 200, 64, 65, 1024, 1 };
+	const unsigned int numSegments = sizeof(irLengths) / sizeof(irLengths[0]);
+
+	PartitionedConvolver convolver;
+	convolver.initialize(CONVOLVER_PARTITION_LEN, CHECK_MAX_IR_LEN);
+	unsigned int partitionLength = convolver.getPartitionLength();
+
+	std::vector<double> input(numSegments * CHECK_SEGMENT_LEN);
+	uint32_t noise = 22222;
+	for (size_t n = 0; n < input.size(); n++)
+	{
+		noise = noise * 196314165 + 907633515;
+		input[n] = (double)(noise >> 8) / 8388608.0 - 1.0;
+	}
+
+	std::vector<double> ir(CHECK_MAX_IR_LEN);
+	bool passed = true;
+
+	for (unsigned int segment = 0; segment < numSegments; segment++)
+	{
+		// --- a decaying noise IR, different for every segment
+		unsigned int irLength = irLengths[segment];
+		for (unsigned int i = 0; i < irLength; i++)
+		{
+			noise = noise * 196314165 + 907633515;
+			ir[i] = ((double)(noise >> 8) / 8388608.0 - 1.0) * exp(-(double)i / 200.0);
+		}
+
+		// --- load it in the middle of a block, as a host would
+		convolver.setImpulseResponse(&ir[0], irLength);
+
+		unsigned int start = segment * CHECK_SEGMENT_LEN;
+		unsigned int numPartitions = irLength > partitionLength ? (irLength - 1) / partitionLength : 0;
+		unsigned int settle = (numPartitions + 1) * partitionLength;
+		double maxError = 0.0;
+
+		for (unsigned int n = start; n < start + CHECK_SEGMENT_LEN; n++)
+		{
+			double yn = convolver.processAudioSample(input[n]);
+
+			double reference = 0.0;
+			for (unsigned int i = 0; i < irLength && i <= n; i++)
+				reference += ir[i] * input[n - i];
+
+			if (n - start >= settle)
+				maxError = fmax(maxError, fabs(yn - reference));
+		}
+
+		bool segmentPassed = maxError <= CHECK_TOLERANCE;
+		printf("IR %4u taps (%2u tail partitions): max error %.3g %s\n", irLength, numPartitions, maxError,
+			   segmentPassed ? "ok" : "FAIL");
+		passed = passed && segmentPassed;
+	}
+
+	printf(passed ? "PASS\n" : "FAIL\n");
+	return passed ? 0 : 1;
+}
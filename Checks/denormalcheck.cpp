@@ -0,0 +1,224 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Check File:  denormalcheck.cpp
+//
+/**
+    \file   denormalcheck.cpp
+    \author Christian George
+    \date   19-October-2026
+    \brief  standalone check of the per-buffer denormal flush (ScopedDenormalGuard) with the
+            per-sample underflow checks compiled out (FXOBJECTS_UNDERFLOW_CHECKS = 0)
+
+    A loud burst followed by a long silent tail is run through a ReverbTank and a chain of
+    low-pass biquads, once with each buffer wrapped in a ScopedDenormalGuard (as
+    PluginBase::processAudioBuffers( ) does) and once without. With the guard:
+    - no subnormal value may appear in the biquad state registers or in any output sample
+      (the reverb outputs are read straight from its delay lines, so they show its state)
+    - the time per block late in the tail may not grow past twice the time at its start
+
+    Without the guard the same figures are printed for comparison only, since the cost of
+    subnormal arithmetic depends on the CPU.
+
+    Build and run from the repository root (fxobjects.cpp is compiled in, see below):
+    g++ -std=c++14 -O2 -IPluginKernel -IPluginObjects -ICustomControls Checks/denormalcheck.cpp -o denormalcheck
+    ./denormalcheck
+
+    The process exits with 0 when the guarded run passes, 1 otherwise.
+*/
+// -----------------------------------------------------------------------------
+#define FXOBJECTS_UNDERFLOW_CHECKS 0
+
+// --- the plugin projects get these through their precompiled headers
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include <chrono>
+#include <vector>
+
+#include "pluginbase.h"
+
+// --- one translation unit, so the check builds with a single command line
+#include "fxobjects.cpp"
+
+const double CHECK_SAMPLE_RATE = 44100.0;
+const uint32_t CHECK_BLOCK_LEN = 512;
+const uint32_t CHECK_BURST_BLOCKS = 20;		///< ~0.25 sec of noise
+const uint32_t CHECK_TAIL_BLOCKS = 4000;	///< ~46 sec of silence
+const uint32_t CHECK_TIMING_SEGMENTS = 10;	///< the tail is split into segments for the timing medians
+const uint32_t CHECK_BIQUADS = 4;
+
+/**
+\struct DenormalCheckResult
+\ingroup Checks
+\brief
+Figures from one run of the burst and tail.
+*/
+struct DenormalCheckResult
+{
+	uint64_t subnormalOutputs = 0;		///< output samples that were subnormal
+	uint64_t subnormalStates = 0;		///< biquad state registers that were subnormal at the end of a block
+	uint32_t firstSubnormalBlock = 0;	///< tail block where the first one showed up (0 = none)
+	double firstSegment_uSec = 0.0;		///< median time per block, first tail segment
+	double worstSegment_uSec = 0.0;		///< median time per block, slowest tail segment
+};
+
+/** true if the value is subnormal */
+inline bool isSubnormal(double value) { return std::fpclassify(value) == FP_SUBNORMAL; }
+
+/** median of a set of block times */
+double getMedian(std::vector<double> times)
+{
+	std::nth_element(times.begin(), times.begin() + times.size() / 2, times.end());
+	return times[times.size() / 2];
+}
+
+/**
+\brief run the burst and tail through freshly reset processors
+
+\param useGuard true to wrap each block in a ScopedDenormalGuard
+\return the figures for the run
+*/
+DenormalCheckResult runBurstAndTail(bool useGuard)
+{
+	DenormalCheckResult result;
+
+	// --- a short, dark tank so its tail reaches the subnormal range well inside the test
+	ReverbTank reverb;
+	reverb.reset(CHECK_SAMPLE_RATE);
+	ReverbTankParameters reverbParams = reverb.getParameters();
+	reverbParams.kRT = 0.5;
+	reverbParams.lpf_g = 0.3;
+	reverbParams.lowShelf_fc = 150.0;
+	reverbParams.highShelf_fc = 4000.0;
+	reverbParams.wetLevel_dB = 0.0;
+	reverbParams.dryLevel_dB = -96.0;
+	reverb.setParameters(reverbParams);
+
+	// --- low-pass sections, direct form: 200 Hz, Q = 2
+	Biquad biquads[CHECK_BIQUADS];
+	double theta = 2.0 * kPi * 200.0 / CHECK_SAMPLE_RATE;
+	double d = 1.0 / 2.0;
+	double betaNumerator = 1.0 - ((d / 2.0)*(sin(theta)));
+	double betaDenominator = 1.0 + ((d / 2.0)*(sin(theta)));
+	double beta = 0.5*(betaNumerator / betaDenominator);
+	double gamma = (0.5 + beta)*(cos(theta));
+	double alpha = (0.5 + beta - gamma) / 2.0;
+	double coeffs[numCoeffs] = { 0.0 };
+	coeffs[a0] = alpha;
+	coeffs[a1] = 2.0*alpha;
+	coeffs[a2] = alpha;
+	coeffs[b1] = -2.0*gamma;
+	coeffs[b2] = 2.0*beta;
+	for (uint32_t i = 0; i < CHECK_BIQUADS; i++)
+	{
+		biquads[i].reset(CHECK_SAMPLE_RATE);
+		biquads[i].setCoefficients(coeffs);
+	}
+
+	uint32_t noise = 22222;
+	uint32_t segmentLen = CHECK_TAIL_BLOCKS / CHECK_TIMING_SEGMENTS;
+	std::vector<double> segmentTimes;
+	segmentTimes.reserve(segmentLen);
+
+	for (uint32_t block = 0; block < CHECK_BURST_BLOCKS + CHECK_TAIL_BLOCKS; block++)
+	{
+		bool inTail = block >= CHECK_BURST_BLOCKS;
+		uint64_t subnormalsBefore = result.subnormalOutputs + result.subnormalStates;
+		auto processBlock = [&]()
+		{
+			for (uint32_t n = 0; n < CHECK_BLOCK_LEN; n++)
+			{
+				float input[2] = { 0.f, 0.f };
+				if (!inTail)
+				{
+					noise = noise * 196314165 + 907633515;
+					input[0] = input[1] = (float)(noise >> 8) / 8388608.f - 1.f;
+				}
+
+				float output[2] = { 0.f, 0.f };
+				reverb.processAudioFrame(input, output, 2, 2);
+				double yn = 0.5*(output[0] + output[1]);
+				for (uint32_t i = 0; i < CHECK_BIQUADS; i++)
+					yn = biquads[i].processAudioSample(i == 0 ? yn + input[0] : yn);
+
+				result.subnormalOutputs += isSubnormal(output[0]) + isSubnormal(output[1]) + isSubnormal(yn);
+			}
+
+			for (uint32_t i = 0; i < CHECK_BIQUADS; i++)
+			{
+				double* state = biquads[i].getStateArray();
+				for (uint32_t j = 0; j < numStates; j++)
+					result.subnormalStates += isSubnormal(state[j]);
+			}
+		};
+
+		auto start = std::chrono::steady_clock::now();
+		if (useGuard)
+		{
+			ScopedDenormalGuard denormalGuard;
+			processBlock();
+		}
+		else
+			processBlock();
+		double elapsed_uSec = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+		if (!inTail)
+			continue;
+
+		uint32_t tailBlock = block - CHECK_BURST_BLOCKS;
+		if (result.firstSubnormalBlock == 0 && result.subnormalOutputs + result.subnormalStates > subnormalsBefore)
+			result.firstSubnormalBlock = tailBlock + 1;
+
+		segmentTimes.push_back(elapsed_uSec);
+		if (segmentTimes.size() < segmentLen)
+			continue;
+
+		double median = getMedian(segmentTimes);
+		if (tailBlock < segmentLen)
+			result.firstSegment_uSec = median;
+		result.worstSegment_uSec = fmax(result.worstSegment_uSec, median);
+		segmentTimes.clear();
+	}
+
+	return result;
+}
+
+/** print the figures for one run */
+void printResult(const char* name, const DenormalCheckResult& result)
+{
+	printf("%s: subnormal outputs %llu, subnormal states %llu, first in tail block %u\n",
+		   name, (unsigned long long)result.subnormalOutputs, (unsigned long long)result.subnormalStates,
+		   result.firstSubnormalBlock);
+	printf("%s: usec per block, first segment %.1f, worst segment %.1f (x%.2f)\n",
+		   name, result.firstSegment_uSec, result.worstSegment_uSec,
+		   result.worstSegment_uSec / result.firstSegment_uSec);
+}
+
+int main()
+{
+	DenormalCheckResult unguarded = runBurstAndTail(false);
+	printResult("no guard", unguarded);
+	if (unguarded.subnormalOutputs + unguarded.subnormalStates == 0)
+		printf("no guard: note: no subnormals without the guard, so this build does not exercise the guard\n");
+
+	DenormalCheckResult guarded = runBurstAndTail(true);
+	printResult("guard   ", guarded);
+
+	bool passed = true;
+	if (guarded.subnormalOutputs + guarded.subnormalStates != 0)
+	{
+		printf("FAIL: subnormals reached the state or the output with the guard set\n");
+		passed = false;
+	}
+	if (guarded.worstSegment_uSec > 2.0 * guarded.firstSegment_uSec)
+	{
+		printf("FAIL: time per block grew over the tail with the guard set\n");
+		passed = false;
+	}
+
+	printf(passed ? "PASS\n" : "FAIL\n");
+	return passed ? 0 : 1;
+}
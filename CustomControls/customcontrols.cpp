@@ -15,6 +15,7 @@
 #include "vstgui/lib/cdrawcontext.h"
 
 #include <cmath>
+#include <algorithm>
 #pragma warning (disable : 4244) // conversion from 'int' to 'float', possible loss of data for knob/slider switch views (this is what we want!)
 
 namespace VSTGUI {
@@ -801,6 +802,74 @@ float CMeterDetector::detect(float input)
 }
 
 
+void CMeterBallistics::clear()
+{
+	envelope.clear();
+	attackCoeff.clear();
+	releaseCoeff.clear();
+	squareMask.clear();
+	sqrtMask.clear();
+	logMask.clear();
+}
+
+uint32_t CMeterBallistics::addMeter(float samplerate, float attack_in_ms, float release_in_ms, bool bAnalogTC, unsigned int uDetect, bool bLogDetector)
+{
+	// --- same coefficients as CMeterDetector::setAttackTime( ) and setReleaseTime( )
+	float tc = bAnalogTC ? ENVELOPE_ANALOG_TC : ENVELOPE_DIGITAL_TC;
+
+	envelope.push_back(0.f);
+	attackCoeff.push_back((float)exp(tc / (attack_in_ms * samplerate * 0.001f)));
+	releaseCoeff.push_back((float)exp(tc / (release_in_ms * samplerate * 0.001f)));
+	squareMask.push_back(uDetect == ENVELOPE_DETECT_MODE_MS || uDetect == ENVELOPE_DETECT_MODE_RMS ? 1.f : 0.f);
+	sqrtMask.push_back(uDetect == ENVELOPE_DETECT_MODE_RMS ? 1.f : 0.f);
+	logMask.push_back(bLogDetector ? 1.f : 0.f);
+
+	return (uint32_t)envelope.size() - 1;
+}
+
+void CMeterBallistics::prepareForPlay()
+{
+	std::fill(envelope.begin(), envelope.end(), 0.f);
+}
+
+void CMeterBallistics::process(const float* input, float* output)
+{
+	const uint32_t count = (uint32_t)envelope.size();
+	float* env = envelope.data();
+	const float* att = attackCoeff.data();
+	const float* rel = releaseCoeff.data();
+	const float* sq = squareMask.data();
+	const float* rt = sqrtMask.data();
+	const float* lg = logMask.data();
+
+	// --- envelope; selects instead of branches so the loop vectorizes
+	for (uint32_t i = 0; i < count; i++)
+	{
+		float x = fabsf(input[i]);
+		x += sq[i] * (x*x - x);
+
+		float coeff = x > env[i] ? att[i] : rel[i];
+		float e = coeff * (env[i] - x) + x;
+
+		// --- flush denormals and bound; can happen when using pre-detector gains of more than 1.0
+		e = e < FLT_MIN_PLUS ? 0.f : e;
+		e = fminf(e, 1.f);
+		env[i] = e;
+
+		output[i] = e + rt[i] * (sqrtf(e) - e);
+	}
+
+	// --- 16-bit scaling, then convert to 0->1 value
+	for (uint32_t i = 0; i < count; i++)
+	{
+		float y = output[i];
+		float fdB = 20.f*log10f(fmaxf(y, FLT_MIN_PLUS));
+		fdB = fmaxf(GUI_METER_MIN_DB, fdB);
+		fdB = (fdB - GUI_METER_MIN_DB) / -GUI_METER_MIN_DB;
+		output[i] = y + lg[i] * (fdB - y);
+	}
+}
+
 CVuMeterEx::CVuMeterEx(const CRect& size, CBitmap* onBitmap, CBitmap* offBitmap, int32_t nbLed, bool bInverted, bool bAnalogVU, int32_t style)
 : CVuMeter(size, onBitmap, offBitmap, nbLed, style)
 {
@@ -823,6 +892,101 @@ void CVuMeterEx::setViewSize(const CRect& newSize, bool invalid)
 	rectOff = getViewSize();
 }
 
+CCoord CVuMeterEx::getLEDOffset(float level)
+{
+	float position = 0.f;
+	CCoord length = 0.0;
+	if (style & kHorizontal)
+	{
+		position = isInverted ? getMax() - level : getMin() + level;
+		length = getOnBitmap()->getWidth();
+	}
+	else
+	{
+		position = isInverted ? level : getMax() - level;
+		length = getOnBitmap()->getHeight();
+	}
+
+	CCoord tmp = (CCoord)(((int32_t)(nbLed * position + 0.5f) / (float)nbLed) * length);
+	// http://ehc.ac/p/vstgui/mailman/vstgui-devel/?page=43
+	// [Vstgui-devel] CVuMeter display bug on Windows
+	tmp = (CCoord)((long)(tmp + 0.5f));
+	if(tmp < 1.0) tmp = 0.0;
+
+	return tmp;
+}
+
+CCoord CVuMeterEx::getFrameOffset(float level)
+{
+	CCoord y = 0.0;
+	if (value >= 0.f && heightOfOneImage > 0.)
+	{
+		CCoord tmp = heightOfOneImage * (subPixMaps - 1);
+		if(isInverted)
+		{
+			double dTop = zero_dB_Frame/subPixMaps;
+			y = floor ((dTop - level*dTop) * tmp);
+		}
+		else
+			y = floor (level * tmp);
+		y -= (int32_t)y % (int32_t)heightOfOneImage;
+	}
+	return y;
+}
+
+/**
+\brief set the meter level after the GUI's batch ballistics have been applied; the meter
+       no longer runs its own detector in draw( ) and only the LEDs between the old and new
+       positions are invalidated (the analog VU invalidates when its frame changes)
+
+\param level - detected level, 0 -> 1
+*/
+void CVuMeterEx::setMeterLevel(float level)
+{
+	externalBallistics = true;
+	value = level;
+
+	if (!getOnBitmap())
+		return;
+
+	// --- for LED's as on/off single LEDs
+	if (!isAnalogVU && nbLed == 2)
+		level = level < 0.5f ? 0.f : 1.f;
+
+	meterLevel = level;
+
+	CCoord offset = isAnalogVU ? getFrameOffset(level) : getLEDOffset(level);
+	if (offset == meterOffset)
+		return;
+
+	if (isAnalogVU || meterOffset < 0.0)
+	{
+		meterOffset = offset;
+		invalid();
+		return;
+	}
+
+	// --- dirty band between the old and new LED positions
+	CRect dirty(getViewSize());
+	CCoord lo = fmin(offset, meterOffset);
+	CCoord hi = fmax(offset, meterOffset);
+	if (style & kHorizontal)
+	{
+		dirty.left = getViewSize().left + lo;
+		dirty.right = getViewSize().left + hi;
+	}
+	else
+	{
+		dirty.top = getViewSize().top + lo;
+		dirty.bottom = getViewSize().top + hi;
+	}
+	dirty.extend(2, 2);
+	dirty.bound(getViewSize());
+
+	meterOffset = offset;
+	invalidRect(dirty);
+}
+
 void CVuMeterEx::draw(CDrawContext *_pContext)
 {
 	if (!getOnBitmap())
@@ -836,12 +1000,15 @@ void CVuMeterEx::draw(CDrawContext *_pContext)
 		CPoint pointOff;
 		CDrawContext *pContext = _pContext;
 
-		bounceValue();
         float newValue = 0.f;
 
+        // --- level already detected by the GUI's batch ballistics
+        if (externalBallistics)
+            newValue = meterLevel;
         // --- for LED's as on/off single LEDs
-        if (nbLed == 2)
+        else if (nbLed == 2)
         {
+            bounceValue();
             if (value < 0.5f)
                 newValue = 0.f;
             else
@@ -849,6 +1016,7 @@ void CVuMeterEx::draw(CDrawContext *_pContext)
         }
         else
         {
+            bounceValue();
             newValue = getOldValue() - decreaseValue;
             if (newValue < value)
                 newValue = value;
@@ -858,28 +1026,17 @@ void CVuMeterEx::draw(CDrawContext *_pContext)
             newValue = detector.detect(newValue);
         }
 
+		CCoord tmp = getLEDOffset(newValue);
         if (style & kHorizontal)
 		{
 			if(!isInverted)
 			{
-				CCoord tmp = (CCoord)(((int32_t)(nbLed * (getMin () + newValue) + 0.5f) / (float)nbLed) * getOnBitmap()->getWidth ());
-				// http://ehc.ac/p/vstgui/mailman/vstgui-devel/?page=43
-				// [Vstgui-devel] CVuMeter display bug on Windows
-				tmp = (CCoord)((long)(tmp + 0.5f));
-				if(tmp < 1.0) tmp = 0.0;
-
 				pointOff(tmp, 0);
 				_rectOff.left += tmp;
 				_rectOn.right = tmp + rectOn.left;
 			}
 			else
 			{
-				CCoord tmp = (CCoord)(((int32_t)(nbLed * (getMax () - newValue) + 0.5f) / (float)nbLed) * getOnBitmap()->getWidth ());
-				// http://ehc.ac/p/vstgui/mailman/vstgui-devel/?page=43
-				// [Vstgui-devel] CVuMeter display bug on Windows
-				tmp = (CCoord)((long)(tmp + 0.5f));
-				if(tmp < 1.0) tmp = 0.0;
-
 				pointOn(tmp, 0);
 				_rectOn.left += tmp;
 				_rectOff.right = tmp + _rectOff.left;
@@ -889,24 +1046,12 @@ void CVuMeterEx::draw(CDrawContext *_pContext)
 		{
 			if(!isInverted)
 			{
-				CCoord tmp = (CCoord)(((int32_t)(nbLed * (getMax () - newValue) + 0.5f) / (float)nbLed) * getOnBitmap()->getHeight ());
-				// http://ehc.ac/p/vstgui/mailman/vstgui-devel/?page=43
-				// [Vstgui-devel] CVuMeter display bug on Windows
-				tmp = (CCoord)((long)(tmp + 0.5f));
-				if(tmp < 1.0) tmp = 0.0;
-
 				pointOn(0, tmp);
 				_rectOff.bottom = tmp + rectOff.top;
 				_rectOn.top += tmp;
 			}
 			else
 			{
-				CCoord tmp = (CCoord)(((int32_t)(nbLed * (newValue) + 0.5f) / (float)nbLed) * getOnBitmap()->getHeight ());
-				// http://ehc.ac/p/vstgui/mailman/vstgui-devel/?page=43
-				// [Vstgui-devel] CVuMeter display bug on Windows
-				tmp = (CCoord)((long)(tmp + 0.5f));
-				if(tmp < 1.0) tmp = 0.0;
-
 				pointOff (0, tmp);
 				_rectOn.bottom = tmp + _rectOn.top;
 				_rectOff.top     += tmp;
@@ -921,31 +1066,21 @@ void CVuMeterEx::draw(CDrawContext *_pContext)
 	{
 		if(getDrawBackground())
 		{
-            bounceValue();
-
-            float newValue = getOldValue() - decreaseValue;
-            if (newValue < value)
-                newValue = value;
-            setOldValue(newValue);
-
-            // --- apply detector *after* storing value
-            newValue = detector.detect(newValue);
+            float newValue = meterLevel;
+            if (!externalBallistics)
+            {
+                bounceValue();
 
+                newValue = getOldValue() - decreaseValue;
+                if (newValue < value)
+                    newValue = value;
+                setOldValue(newValue);
 
-			CPoint where (0, 0);
-			if (value >= 0.f && heightOfOneImage > 0.)
-			{
-				CCoord tmp = heightOfOneImage * (subPixMaps - 1);
-				if(isInverted)
-				{
-					double dTop = zero_dB_Frame/subPixMaps;
-					where.y = floor ((dTop - newValue*dTop) * tmp);
-				}
-				else
-					where.y = floor (newValue * tmp);
-				where.y -= (int32_t)where.y % (int32_t)heightOfOneImage;
-			}
+                // --- apply detector *after* storing value
+                newValue = detector.detect(newValue);
+            }
 
+			CPoint where (0, getFrameOffset(newValue));
 			getDrawBackground()->draw (_pContext, getViewSize (), where);
 		}
 	}
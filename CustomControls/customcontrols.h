@@ -23,6 +23,8 @@
 #include "vstgui/lib/vstguibase.h"
 #include "guiconstants.h"
 
+#include <vector>
+
 namespace VSTGUI {
 
  /**
@@ -480,6 +482,49 @@ protected:
     }
 };
 
+/**
+\class CMeterBallistics
+\ingroup Custom-Controls
+\brief
+The CMeterBallistics object runs the meter ballistics for every meter on the GUI in one batch.\n
+It is the structure-of-arrays version of CMeterDetector: each meter occupies one slot, and the
+per-slot coefficients are stored as masks so that process() has no data dependent branches and
+the loops vectorize. PluginGUI::idle( ) calls process( ) once per timer tick for all meters.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 18
+*/
+class CMeterBallistics
+{
+public:
+	CMeterBallistics(void) {}
+	~CMeterBallistics(void) {}
+
+	/** remove all meters */
+	void clear();
+
+	/** add a meter slot with the same settings as CMeterDetector::init( ); returns the slot index */
+	uint32_t addMeter(float samplerate, float attack_in_ms, float release_in_ms, bool bAnalogTC, unsigned int uDetect, bool bLogDetector);
+
+	/** number of meter slots */
+	uint32_t getMeterCount() { return (uint32_t)envelope.size(); }
+
+	/** clear the envelopes */
+	void prepareForPlay();
+
+	/** run one tick of ballistics on all meters; input and output must hold getMeterCount( ) values */
+	void process(const float* input, float* output);
+
+protected:
+	std::vector<float> envelope;	///< per-meter envelope (prior to sqrt for RMS)
+	std::vector<float> attackCoeff;	///< per-meter attack coefficient
+	std::vector<float> releaseCoeff;///< per-meter release coefficient
+	std::vector<float> squareMask;	///< 1.0 = square the input (MS, RMS)
+	std::vector<float> sqrtMask;	///< 1.0 = sqrt the envelope (RMS)
+	std::vector<float> logMask;		///< 1.0 = log (dB) scaling
+};
+
 /**
 \class CVuMeterEx
 \ingroup Custom-Controls
@@ -508,8 +553,25 @@ public:
 	{
 		detector.init(samplerate, attack_in_ms, release_in_ms, bAnalogTC, uDetect, bLogDetector);
 		detector.prepareForPlay();
+
+		// --- save for the GUI's batch ballistics
+		detectorSampleRate = samplerate;
+		detectorAttack_mSec = attack_in_ms;
+		detectorRelease_mSec = release_in_ms;
+		detectorAnalogTC = bAnalogTC;
+		detectorMode = uDetect;
+		detectorLog = bLogDetector;
+	}
+
+	/** add this meter's detector settings to a batch; returns the slot index */
+	inline uint32_t addToBallistics(CMeterBallistics& ballistics)
+	{
+		return ballistics.addMeter(detectorSampleRate, detectorAttack_mSec, detectorRelease_mSec, detectorAnalogTC, detectorMode, detectorLog);
 	}
 
+	/** set the detected (post-ballistics) meter level; invalidates only the LED band that changed */
+	void setMeterLevel(float level);
+
 	void setHtOneImage(double d){heightOfOneImage = d;}
 	void setImageCount(double d){subPixMaps = d;}
 	void setZero_dB_Frame(double d){zero_dB_Frame = d;}
@@ -522,6 +584,22 @@ protected:
 	double subPixMaps;
 
 	CMeterDetector detector;
+
+	// --- LED/frame offset for a given meter level
+	CCoord getLEDOffset(float level);
+	CCoord getFrameOffset(float level);
+
+	// --- batch ballistics state; see setMeterLevel( )
+	bool externalBallistics = false;
+	float meterLevel = 0.f;
+	CCoord meterOffset = -1.0;
+
+	float detectorSampleRate = 1.f / (GUI_METER_UPDATE_INTERVAL_MSEC*0.001f);
+	float detectorAttack_mSec = 0.f;
+	float detectorRelease_mSec = 0.f;
+	bool detectorAnalogTC = false;
+	unsigned int detectorMode = ENVELOPE_DETECT_MODE_PEAK;
+	bool detectorLog = false;
 };
 
 /**
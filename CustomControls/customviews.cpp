@@ -15,6 +15,12 @@
 
 namespace VSTGUI {
 
+// --- analyzer and response view display range
+const double ANALYZER_MIN_FREQ = 20.0;
+const double ANALYZER_MAX_FREQ = 20000.0;
+const double ANALYZER_MIN_DB = -90.0;
+const double ANALYZER_DECAY_DB = 3.0; ///< per update
+
 /**
 \brief WaveView constructor
 
@@ -101,6 +107,118 @@ void WaveView::clearBuffer()
 	readIndex = 0;
 }
 
+void WaveView::setNumTraces(int _numTraces)
+{
+	numTraces = _numTraces > 0 ? _numTraces : 0;
+
+	// --- multi-trace mode stores a [top, bottom] pair per trace per column
+	int lanes = numTraces > 0 ? numTraces * 2 : 1;
+	if (circularBuffer)
+		delete[] circularBuffer;
+	circularBuffer = new double[circularBufferLength * lanes];
+	memset(circularBuffer, 0, circularBufferLength * lanes * sizeof(double));
+
+	traceColors.resize(numTraces, CColor(32, 0, 255, 200));
+	writeIndex = 0;
+	readIndex = 0;
+
+	// --- everything needs rendering
+	pendingColumns = circularBufferLength;
+}
+
+void WaveView::setTraceColor(int trace, const CColor& color)
+{
+	if (trace < 0 || trace >= numTraces) return;
+	traceColors[trace] = color;
+}
+
+void WaveView::setTraceDataPoint(int trace, float top, float bottom)
+{
+	if (!circularBuffer || trace < 0 || trace >= numTraces) return;
+
+	double* point = &circularBuffer[(writeIndex*numTraces + trace) * 2];
+	point[0] = top;
+	point[1] = bottom;
+}
+
+void WaveView::advanceColumn()
+{
+	writeIndex++;
+	if (writeIndex > circularBufferLength - 1)
+		writeIndex = 0;
+
+	if (pendingColumns < circularBufferLength)
+		pendingColumns++;
+}
+
+void WaveView::drawColumn(CDrawContext* pContext, int column, CCoord x, CCoord top, CCoord height)
+{
+	// --- clear the column
+	pContext->setFillColor(CColor(200, 200, 200, 255)); // light grey
+	pContext->drawRect(CRect(x, top, x + 1, top + height), kDrawFilled);
+
+	const double* point = &circularBuffer[column*numTraces * 2];
+	for (int trace = 0; trace < numTraces; trace++, point += 2)
+	{
+		CCoord y1 = top + point[0] * height;
+		CCoord y2 = top + point[1] * height;
+
+		// --- at least one pixel so a flat trace is still visible
+		if (y2 < y1 + 1.0)
+			y2 = y1 + 1.0;
+
+		pContext->setFrameColor(traceColors[trace]);
+		pContext->drawLine(CPoint(x, y1), CPoint(x, y2));
+	}
+}
+
+void WaveView::renderNewColumns()
+{
+	if (numTraces == 0 || pendingColumns == 0 || !circularBuffer)
+		return;
+
+	CRect size = getViewSize();
+
+	// --- needs the frame; until then draw() paints every column directly
+	if (!offscreen)
+	{
+		if (!getFrame())
+		{
+			invalid();
+			return;
+		}
+
+		offscreen = COffscreenContext::create(getFrame(), size.getWidth(), size.getHeight());
+		if (!offscreen)
+		{
+			invalid();
+			return;
+		}
+
+		pendingColumns = circularBufferLength;
+	}
+
+	// --- offscreen column x holds circular buffer column x
+	int column = writeIndex - pendingColumns;
+	if (column < 0)
+		column += circularBufferLength;
+
+	offscreen->beginDraw();
+	offscreen->setLineWidth(1);
+	for (int i = 0; i < pendingColumns; i++)
+	{
+		drawColumn(offscreen.get(), column, column, 0.0, size.getHeight());
+		if (++column > circularBufferLength - 1)
+			column = 0;
+	}
+	offscreen->endDraw();
+
+	pendingColumns = 0;
+
+	// --- this will set the dirty flag to repaint the view
+	invalid();
+}
+
 void WaveView::draw(CDrawContext* pContext)
 {
     // --- setup the backround rectangle
@@ -111,6 +229,32 @@ void WaveView::draw(CDrawContext* pContext)
     pContext->setFrameColor(CColor(0, 0, 0, 255)); // black
 	CRect size = getViewSize();
 
+	// --- multi-trace: blit the rendered columns, oldest (at writeIndex) on the left
+	if (numTraces > 0)
+	{
+		if (offscreen && offscreen->getBitmap())
+		{
+			CCoord split = circularBufferLength - writeIndex;
+			offscreen->getBitmap()->draw(pContext, CRect(size.left, size.top, size.left + split, size.bottom), CPoint(writeIndex, 0));
+			if (writeIndex > 0)
+				offscreen->getBitmap()->draw(pContext, CRect(size.left + split, size.top, size.right, size.bottom), CPoint(0, 0));
+		}
+		else if (circularBuffer)
+		{
+			int column = writeIndex;
+			for (int i = 0; i < circularBufferLength; i++)
+			{
+				drawColumn(pContext, column, size.left + i, size.top, size.getHeight());
+				if (++column > circularBufferLength - 1)
+					column = 0;
+			}
+		}
+
+		pContext->setFrameColor(CColor(0, 0, 0, 255)); // black
+		pContext->drawRect(size, kDrawStroked);
+		return;
+	}
+
     // --- draw the rect filled (with grey) and stroked (line around rectangle)
     pContext->drawRect(size, kDrawFilledAndStroked);
 
@@ -168,6 +312,401 @@ void WaveView::draw(CDrawContext* pContext)
     }
 }
 
+/**
+\brief GainReductionView constructor
+
+\param size - the control rectangle
+\param listener - the control's listener (usuall PluginGUI object)
+\param tag - the control ID value
+*/
+GainReductionView::GainReductionView(const VSTGUI::CRect& size, IControlListener* listener, int32_t tag)
+: WaveView(size, listener, tag)
+{
+	// --- ICustomView
+	// --- create our incoming data-queue; try_enqueue( ) never allocates past this
+	dataQueue = new moodycamel::ReaderWriterQueue<GainReductionDataBlock, GR_QUEUE_LEN>(GR_QUEUE_LEN);
+
+	// --- bands 1-4, then mid and side
+	setNumTraces(GR_HISTORY_TRACES);
+	setTraceColor(0, CColor(255, 64, 64, 200));
+	setTraceColor(1, CColor(255, 160, 0, 200));
+	setTraceColor(2, CColor(32, 160, 32, 200));
+	setTraceColor(3, CColor(32, 0, 255, 200));
+	setTraceColor(4, CColor(160, 0, 160, 200));
+	setTraceColor(5, CColor(0, 160, 160, 200));
+}
+
+GainReductionView::~GainReductionView()
+{
+	if (dataQueue)
+		delete dataQueue;
+}
+
+void GainReductionView::sendMessage(void* data)
+{
+	if (!dataQueue || !data) return;
+
+	// --- audio thread: copy the block; if the GUI has fallen behind, the block is dropped
+	dataQueue->try_enqueue(*(GainReductionDataBlock*)data);
+}
+
+float GainReductionView::gainToFraction(float gain)
+{
+	float dB = 20.f*log10f(fmaxf(gain, 1.0e-6f));
+	float fraction = dB / (float)rangeDB;
+	return fminf(fmaxf(fraction, 0.f), 1.f);
+}
+
+void GainReductionView::updateView()
+{
+	if (!dataQueue) return;
+
+	// --- one column per block; least reduction at the top of the line
+	GainReductionDataBlock block;
+	while (dataQueue->try_dequeue(block))
+	{
+		for (int trace = 0; trace < numTraces; trace++)
+			setTraceDataPoint(trace, gainToFraction(block.gainMax[trace]), gainToFraction(block.gainMin[trace]));
+
+		advanceColumn();
+	}
+
+	// --- renders and invalidates only if there are new columns
+	renderNewColumns();
+}
+
+/**
+\brief TransferCurveView constructor
+
+\param size - the control rectangle
+\param listener - the control's listener (usuall PluginGUI object)
+\param tag - the control ID value
+*/
+TransferCurveView::TransferCurveView(const VSTGUI::CRect& size, IControlListener* listener, int32_t tag)
+: CControl(size, listener, tag)
+{
+	// --- ICustomView
+	// --- create our incoming data-queue; try_enqueue( ) never allocates past this
+	dataQueue = new moodycamel::ReaderWriterQueue<DynamicsCurveData, RESPONSE_QUEUE_LEN>(RESPONSE_QUEUE_LEN);
+
+	// --- the static curve does not depend on the sample rate
+	processor.reset(44100.0);
+	setRange(minDB);
+}
+
+TransferCurveView::~TransferCurveView()
+{
+	if (dataQueue)
+		delete dataQueue;
+}
+
+void TransferCurveView::sendMessage(void* data)
+{
+	if (!dataQueue || !data) return;
+
+	// --- audio thread: copy the data; if the GUI has fallen behind, it is dropped
+	dataQueue->try_enqueue(*(DynamicsCurveData*)data);
+}
+
+void TransferCurveView::setRange(double _minDB)
+{
+	minDB = _minDB;
+	for (int i = 0; i < RESPONSE_POINTS; i++)
+		inputGrid[i] = minDB - minDB*i / (RESPONSE_POINTS - 1);
+
+	if (curveValid)
+		computeCurve();
+}
+
+bool TransferCurveView::curveChanged(const DynamicsCurveData& data)
+{
+	return data.threshold_dB != curveData.threshold_dB ||
+		data.ratio != curveData.ratio ||
+		data.kneeWidth_dB != curveData.kneeWidth_dB ||
+		data.outputGain_dB != curveData.outputGain_dB ||
+		data.softKnee != curveData.softKnee ||
+		data.hardLimitGate != curveData.hardLimitGate ||
+		data.expander != curveData.expander;
+}
+
+void TransferCurveView::computeCurve()
+{
+	DynamicsProcessorParameters params = processor.getParameters();
+	params.threshold_dB = curveData.threshold_dB;
+	params.ratio = curveData.ratio;
+	params.kneeWidth_dB = curveData.kneeWidth_dB;
+	params.outputGain_dB = curveData.outputGain_dB;
+	params.softKnee = curveData.softKnee;
+	params.hardLimitGate = curveData.hardLimitGate;
+	params.calculation = curveData.expander ? dynamicsProcessorType::kDownwardExpander : dynamicsProcessorType::kCompressor;
+	processor.setParameters(params);
+
+	processor.computeTransferCurve(inputGrid, outputCurve, RESPONSE_POINTS);
+	curveValid = true;
+}
+
+double TransferCurveView::levelToOffset(double level_dB, double length)
+{
+	double offset = length * (level_dB - minDB) / -minDB;
+	return fmin(fmax(offset, 0.0), length);
+}
+
+CRect TransferCurveView::getDotRect(double level_dB)
+{
+	CRect size = getViewSize();
+
+	// --- interpolate the curve at the detector level
+	double index = (RESPONSE_POINTS - 1) * (level_dB - minDB) / -minDB;
+	index = fmin(fmax(index, 0.0), RESPONSE_POINTS - 1.0);
+	int n = (int)index;
+	int n1 = n < RESPONSE_POINTS - 1 ? n + 1 : n;
+	double output_dB = doLinearInterpolation(outputCurve[n], outputCurve[n1], index - n);
+
+	// --- whole pixels so that small level changes do not repaint
+	CCoord x = floor(size.left + levelToOffset(level_dB, size.getWidth()));
+	CCoord y = floor(size.bottom - levelToOffset(output_dB, size.getHeight()));
+	return CRect(x - 3, y - 3, x + 4, y + 4);
+}
+
+void TransferCurveView::updateView()
+{
+	if (!dataQueue) return;
+
+	// --- keep the latest data; recompute the curve only when its settings change
+	bool newData = false;
+	bool newCurve = false;
+	DynamicsCurveData data;
+	while (dataQueue->try_dequeue(data))
+	{
+		if (!curveValid || curveChanged(data))
+		{
+			curveData = data;
+			newCurve = true;
+		}
+
+		detect_dB = data.detect_dB;
+		newData = true;
+	}
+
+	if (!newData)
+		return;
+
+	if (newCurve)
+	{
+		computeCurve();
+		dotRect = getDotRect(detect_dB);
+		invalid();
+		return;
+	}
+
+	// --- only the dot moved
+	CRect newDotRect = getDotRect(detect_dB);
+	if (newDotRect == dotRect)
+		return;
+
+	invalidRect(dotRect);
+	invalidRect(newDotRect);
+	dotRect = newDotRect;
+}
+
+void TransferCurveView::draw(CDrawContext* pContext)
+{
+	// --- setup the backround rectangle
+	int frameWidth = 1;
+	pContext->setLineWidth(frameWidth);
+	pContext->setFillColor(CColor(32, 32, 32, 255)); // dark grey
+	pContext->setFrameColor(CColor(0, 0, 0, 255)); // black
+
+	CRect size = getViewSize();
+	pContext->drawRect(size, kDrawFilledAndStroked);
+
+	double width = size.getWidth();
+	double height = size.getHeight();
+
+	// --- unity gain line
+	pContext->setFrameColor(CColor(96, 96, 96, 255));
+	pContext->drawLine(CPoint(size.left, size.bottom), CPoint(size.right, size.top));
+
+	if (!curveValid)
+		return;
+
+	// --- curve
+	pContext->setFrameColor(CColor(32, 200, 255, 255));
+	CPoint lastPoint(size.left + levelToOffset(inputGrid[0], width), size.bottom - levelToOffset(outputCurve[0], height));
+	for (int i = 1; i < RESPONSE_POINTS; i++)
+	{
+		const CPoint p2(size.left + levelToOffset(inputGrid[i], width), size.bottom - levelToOffset(outputCurve[i], height));
+		pContext->drawLine(lastPoint, p2);
+		lastPoint = p2;
+	}
+
+	// --- live dot
+	pContext->setFillColor(CColor(255, 200, 0, 255));
+	pContext->drawEllipse(dotRect, kDrawFilled);
+}
+
+/**
+\brief CrossoverResponseView constructor
+
+\param size - the control rectangle
+\param listener - the control's listener (usuall PluginGUI object)
+\param tag - the control ID value
+*/
+CrossoverResponseView::CrossoverResponseView(const VSTGUI::CRect& size, IControlListener* listener, int32_t tag)
+: CControl(size, listener, tag)
+{
+	// --- ICustomView
+	// --- create our incoming data-queue; try_enqueue( ) never allocates past this
+	dataQueue = new moodycamel::ReaderWriterQueue<CrossoverResponseData, RESPONSE_QUEUE_LEN>(RESPONSE_QUEUE_LEN);
+}
+
+CrossoverResponseView::~CrossoverResponseView()
+{
+	if (dataQueue)
+		delete dataQueue;
+}
+
+void CrossoverResponseView::sendMessage(void* data)
+{
+	if (!dataQueue || !data) return;
+
+	// --- audio thread: copy the data; if the GUI has fallen behind, it is dropped
+	dataQueue->try_enqueue(*(CrossoverResponseData*)data);
+}
+
+void CrossoverResponseView::updateGrid()
+{
+	// --- log frequency grid, ANALYZER_MIN_FREQ to ANALYZER_MAX_FREQ; clamped at Nyquist
+	double ratio = log(ANALYZER_MAX_FREQ / ANALYZER_MIN_FREQ);
+	for (int i = 0; i < RESPONSE_POINTS; i++)
+	{
+		double f = ANALYZER_MIN_FREQ * exp(ratio * i / (RESPONSE_POINTS - 1));
+		double theta = fmin(2.0*kPi*f / responseData.sampleRate, kPi);
+		cosTheta[i] = cos(theta);
+	}
+
+	for (int j = 0; j < 3; j++)
+		filterBank[j].reset(responseData.sampleRate);
+}
+
+void CrossoverResponseView::computeResponses()
+{
+	LRFilterBankParameters params;
+	for (int j = 0; j < 3; j++)
+	{
+		params.splitFrequency = responseData.splitF[j];
+		filterBank[j].setParameters(params);
+	}
+
+	// --- band 1 = LF1, band 2 = HF1*LF2, band 3 = HF1*HF2*LF3, band 4 = HF1*HF2*HF3
+	//     bandMag[3] holds the running HF product until the last splitter
+	for (int i = 0; i < RESPONSE_POINTS; i++)
+		bandMag[3][i] = 1.0;
+
+	for (int j = 0; j < 3; j++)
+	{
+		filterBank[j].getMagResponse(cosTheta, RESPONSE_POINTS, lfMag, hfMag);
+		for (int i = 0; i < RESPONSE_POINTS; i++)
+		{
+			bandMag[j][i] = bandMag[3][i] * lfMag[i];
+			bandMag[3][i] *= hfMag[i];
+		}
+	}
+
+	for (int b = 0; b < 4; b++)
+	{
+		for (int i = 0; i < RESPONSE_POINTS; i++)
+			bandMag[b][i] = 20.0*log10(fmax(bandMag[b][i], 1.0e-6));
+	}
+
+	responseValid = true;
+}
+
+double CrossoverResponseView::dBToY(double dB, double height)
+{
+	// --- +6dB at the top, -48dB at the bottom
+	double y = height * (6.0 - dB) / 54.0;
+	return fmin(fmax(y, 0.0), height);
+}
+
+void CrossoverResponseView::updateView()
+{
+	if (!dataQueue) return;
+
+	// --- keep the latest data
+	bool newData = false;
+	CrossoverResponseData data;
+	while (dataQueue->try_dequeue(data))
+		newData = true;
+
+	if (!newData)
+		return;
+
+	bool newSampleRate = !responseValid || data.sampleRate != responseData.sampleRate;
+	bool newSplits = newSampleRate ||
+		data.splitF[0] != responseData.splitF[0] ||
+		data.splitF[1] != responseData.splitF[1] ||
+		data.splitF[2] != responseData.splitF[2];
+
+	if (!newSplits)
+		return;
+
+	responseData = data;
+	if (newSampleRate)
+		updateGrid();
+
+	computeResponses();
+
+	// --- this will set the dirty flag to repaint the view
+	invalid();
+}
+
+void CrossoverResponseView::draw(CDrawContext* pContext)
+{
+	// --- setup the backround rectangle
+	int frameWidth = 1;
+	pContext->setLineWidth(frameWidth);
+	pContext->setFillColor(CColor(32, 32, 32, 255)); // dark grey
+	pContext->setFrameColor(CColor(0, 0, 0, 255)); // black
+
+	CRect size = getViewSize();
+	pContext->drawRect(size, kDrawFilledAndStroked);
+
+	double width = size.getWidth();
+	double height = size.getHeight();
+
+	// --- 0dB line
+	pContext->setFrameColor(CColor(96, 96, 96, 255));
+	pContext->drawLine(CPoint(size.left, size.top + dBToY(0.0, height)), CPoint(size.right, size.top + dBToY(0.0, height)));
+
+	if (!responseValid)
+		return;
+
+	// --- crossover markers
+	double ratio = log(ANALYZER_MAX_FREQ / ANALYZER_MIN_FREQ);
+	pContext->setFrameColor(CColor(255, 200, 0, 160));
+	for (int j = 0; j < 3; j++)
+	{
+		double x = size.left + width * log(responseData.splitF[j] / ANALYZER_MIN_FREQ) / ratio;
+		pContext->drawLine(CPoint(x, size.top + frameWidth), CPoint(x, size.bottom - frameWidth));
+	}
+
+	// --- band responses
+	const CColor bandColors[4] = { CColor(255, 64, 64, 255), CColor(255, 160, 0, 255), CColor(32, 160, 32, 255), CColor(32, 120, 255, 255) };
+	double step = width / (RESPONSE_POINTS - 1);
+	for (int b = 0; b < 4; b++)
+	{
+		pContext->setFrameColor(bandColors[b]);
+		CPoint lastPoint(size.left, size.top + dBToY(bandMag[b][0], height));
+		for (int i = 1; i < RESPONSE_POINTS; i++)
+		{
+			const CPoint p2(size.left + i*step, size.top + dBToY(bandMag[b][i], height));
+			pContext->drawLine(lastPoint, p2);
+			lastPoint = p2;
+		}
+	}
+}
+
 #ifdef HAVE_FFTW
 /**
 \brief SpectrumView constructor
@@ -195,12 +734,10 @@ SpectrumView::SpectrumView(const VSTGUI::CRect& size, IControlListener* listener
     currentFFTMagBuffer = nullptr;
 
     // --- FFTW inits
-    data        = (fftw_complex*) fftw_malloc(sizeof(fftw_complex) * FFT_LEN);
-    fft_result  = (fftw_complex*) fftw_malloc(sizeof(fftw_complex) * FFT_LEN);
-    ifft_result = (fftw_complex*) fftw_malloc(sizeof(fftw_complex) * FFT_LEN);
+    data        = (double*) fftw_malloc(sizeof(double) * FFT_LEN);
+    fft_result  = (fftw_complex*) fftw_malloc(sizeof(fftw_complex) * (FFT_LEN / 2 + 1));
 
-    plan_forward  = fftw_plan_dft_1d(FFT_LEN, data, fft_result, FFTW_FORWARD, FFTW_ESTIMATE);
-    plan_backward = fftw_plan_dft_1d(FFT_LEN, fft_result, ifft_result, FFTW_BACKWARD, FFTW_ESTIMATE);
+    plan_forward = FFTPlanRegistry::getInstance().getPlan(FFT_LEN, fftPlanType::kRealForward);
 
     // --- window
     setWindow(spectrumViewWindowType::kBlackmanHarrisWindow);
@@ -208,12 +745,8 @@ SpectrumView::SpectrumView(const VSTGUI::CRect& size, IControlListener* listener
 
 SpectrumView::~SpectrumView()
 {
-    fftw_destroy_plan( plan_forward );
-    fftw_destroy_plan( plan_backward );
-
     fftw_free( data );
     fftw_free( fft_result );
-    fftw_free( ifft_result );
 
     if(dataQueue)
         delete dataQueue;
@@ -252,8 +785,7 @@ bool SpectrumView::addFFTInputData(double inputSample)
     if(fftInputCounter >= FFT_LEN)
         return false;
 
-    data[fftInputCounter][0] = inputSample*fftWindow[fftInputCounter]; // stick your audio samples in here
-    data[fftInputCounter][1] = 0.0; // use this if your data is complex valued
+    data[fftInputCounter] = inputSample*fftWindow[fftInputCounter]; // stick your audio samples in here
 
     fftInputCounter++;
     if(fftInputCounter == FFT_LEN)
@@ -294,7 +826,7 @@ void SpectrumView::updateView()
     if(fftReady)
     {
         // do the FFT
-        fftw_execute(plan_forward);
+        fftw_execute_dft_r2c(plan_forward, data, fft_result);
 
         double* bufferToFill = nullptr;
         fftMagBuffersEmpty->try_dequeue(bufferToFill);
@@ -307,13 +839,14 @@ void SpectrumView::updateView()
         }
 
         int maxIndex = 0;
-        for(int i=0; i<FFT_LEN; i++)
+        // --- the upper half of a real signal's FFT is a mirror image, so only N/2 + 1 bins are computed
+        for(int i=0; i<FFT_LEN / 2 + 1; i++)
         {
             bufferToFill[i] = (getMagnitude(fft_result[i][0], fft_result[i][1]));
         }
 
         // --- normalize the FFT buffer for max = 1.0 (note this is NOT dB!!)
-        normalizeBufferGetFMax(bufferToFill, 512, &maxIndex);
+        normalizeBufferGetFMax(bufferToFill, FFT_LEN / 2 + 1, &maxIndex);
 
         // 1) homework = do plot in dB
         // 2) homework = add other windows
@@ -417,6 +950,213 @@ void SpectrumView::draw(CDrawContext* pContext)
     }
 }
 
+/**
+\brief BandSpectrumView constructor
+
+\param size - the control rectangle
+\param listener - the control's listener (usuall PluginGUI object)
+\param tag - the control ID value
+*/
+BandSpectrumView::BandSpectrumView(const VSTGUI::CRect& size, IControlListener* listener, int32_t tag)
+: CControl(size, listener, tag)
+{
+	// --- ICustomView
+	// --- create our incoming data-queue; try_enqueue( ) never allocates past this
+	dataQueue = new moodycamel::ReaderWriterQueue<AnalyzerDataBlock, ANALYZER_QUEUE_LEN>(ANALYZER_QUEUE_LEN);
+
+	// --- FFTW inits; the registry plan is shared by both traces (and every other view of this size)
+	fftInput = (double*)fftw_malloc(sizeof(double) * ANALYZER_FFT_LEN);
+	fftOutput = (fftw_complex*)fftw_malloc(sizeof(fftw_complex) * (ANALYZER_FFT_LEN / 2 + 1));
+	plan_forward = FFTPlanRegistry::getInstance().getPlan(ANALYZER_FFT_LEN, fftPlanType::kRealForward);
+
+	// --- Blackman-Harris window
+	double sum = 0.0;
+	for (int n = 0; n < ANALYZER_FFT_LEN; n++)
+	{
+		fftWindow[n] = (0.42323 - (0.49755*cos((n*2.0*M_PI) / ANALYZER_FFT_LEN)) + 0.07922*cos((2 * n*2.0*M_PI) / ANALYZER_FFT_LEN));
+		sum += fftWindow[n];
+	}
+	windowScale = 2.0 / sum;
+}
+
+BandSpectrumView::~BandSpectrumView()
+{
+	fftw_free(fftInput);
+	fftw_free(fftOutput);
+
+	if (dataQueue)
+		delete dataQueue;
+}
+
+void BandSpectrumView::sendMessage(void* data)
+{
+	if (!dataQueue || !data) return;
+
+	// --- audio thread: copy the block; if the GUI has fallen behind, the block is dropped
+	dataQueue->try_enqueue(*(AnalyzerDataBlock*)data);
+}
+
+double BandSpectrumView::frequencyToX(double frequency, double width)
+{
+	return width * log(frequency / ANALYZER_MIN_FREQ) / log(ANALYZER_MAX_FREQ / ANALYZER_MIN_FREQ);
+}
+
+double BandSpectrumView::dBToY(double dB, double height)
+{
+	double y = height * dB / ANALYZER_MIN_DB;
+	return fmin(fmax(y, 0.0), height);
+}
+
+void BandSpectrumView::updateColumnMap()
+{
+	int width = (int)getViewSize().getWidth();
+	double binWidth = sampleRate / ANALYZER_FFT_LEN;
+	double ratio = log(ANALYZER_MAX_FREQ / ANALYZER_MIN_FREQ);
+
+	columnBinLo.assign(width, -1);
+	columnBinHi.assign(width, -1);
+	preColumns.assign(width, (float)ANALYZER_MIN_DB);
+	postColumns.assign(width, (float)ANALYZER_MIN_DB);
+
+	for (int x = 0; x < width; x++)
+	{
+		double fLo = ANALYZER_MIN_FREQ * exp(ratio * x / width);
+		double fHi = ANALYZER_MIN_FREQ * exp(ratio * (x + 1) / width);
+		if (fLo >= 0.5*sampleRate)
+			break;
+
+		// --- at least one bin per column; low columns share bins
+		int binLo = (int)(fLo / binWidth + 0.5);
+		int binHi = (int)(fHi / binWidth + 0.5);
+		binLo = binLo < ANALYZER_FFT_LEN / 2 ? binLo : ANALYZER_FFT_LEN / 2;
+		binHi = binHi > binLo ? binHi : binLo + 1;
+		binHi = binHi < ANALYZER_FFT_LEN / 2 + 1 ? binHi : ANALYZER_FFT_LEN / 2 + 1;
+
+		columnBinLo[x] = binLo;
+		columnBinHi[x] = binHi;
+	}
+
+	columnSampleRate = sampleRate;
+}
+
+void BandSpectrumView::analyze(const double* history, std::vector<float>& columns)
+{
+	// --- unwrap the history (oldest first) and window it
+	for (int n = 0; n < ANALYZER_FFT_LEN; n++)
+		fftInput[n] = history[(historyWriteIndex + n) & (ANALYZER_FFT_LEN - 1)] * fftWindow[n];
+
+	fftw_execute_dft_r2c(plan_forward, fftInput, fftOutput);
+
+	// --- squared magnitudes; sqrt and log are deferred to the (far fewer) columns
+	const int numBins = ANALYZER_FFT_LEN / 2 + 1;
+	for (int k = 0; k < numBins; k++)
+		binMagnitude[k] = (float)(fftOutput[k][0] * fftOutput[k][0] + fftOutput[k][1] * fftOutput[k][1]);
+
+	const float powerScale = (float)(windowScale * windowScale);
+	for (size_t x = 0; x < columns.size(); x++)
+	{
+		if (columnBinLo[x] < 0)
+			break;
+
+		float peak = 0.f;
+		for (int k = columnBinLo[x]; k < columnBinHi[x]; k++)
+			peak = fmaxf(peak, binMagnitude[k]);
+
+		float dB = 10.f*log10f(fmaxf(peak*powerScale, 1.0e-12f));
+
+		// --- instant attack, constant fall
+		columns[x] = fmaxf(dB, columns[x] - (float)ANALYZER_DECAY_DB);
+	}
+}
+
+void BandSpectrumView::updateView()
+{
+	if (!dataQueue) return;
+
+	// --- drain the queue into the history
+	bool newData = false;
+	while (dataQueue->try_dequeue(incomingBlock))
+	{
+		for (uint32_t i = 0; i < incomingBlock.count; i++)
+		{
+			preHistory[historyWriteIndex] = incomingBlock.pre[i];
+			postHistory[historyWriteIndex] = incomingBlock.post[i];
+			historyWriteIndex = (historyWriteIndex + 1) & (ANALYZER_FFT_LEN - 1);
+		}
+
+		sampleRate = incomingBlock.sampleRate;
+		for (int i = 0; i < 3; i++)
+			splitF[i] = incomingBlock.splitF[i];
+
+		newData = true;
+	}
+
+	if (!newData)
+		return;
+
+	if (sampleRate != columnSampleRate || (int)preColumns.size() != (int)getViewSize().getWidth())
+		updateColumnMap();
+
+	analyze(preHistory, preColumns);
+	analyze(postHistory, postColumns);
+
+	// --- this will set the dirty flag to repaint the view
+	invalid();
+}
+
+void BandSpectrumView::draw(CDrawContext* pContext)
+{
+	// --- setup the backround rectangle
+	int frameWidth = 1;
+	pContext->setLineWidth(frameWidth);
+	pContext->setFillColor(CColor(32, 32, 32, 255)); // dark grey
+	pContext->setFrameColor(CColor(0, 0, 0, 255)); // black
+
+	CRect size = getViewSize();
+	pContext->drawRect(size, kDrawFilledAndStroked);
+
+	double width = size.getWidth();
+	double height = size.getHeight();
+
+	// --- crossover markers
+	pContext->setFrameColor(CColor(255, 200, 0, 160));
+	for (int i = 0; i < 3; i++)
+	{
+		if (splitF[i] <= ANALYZER_MIN_FREQ || splitF[i] >= 0.5*sampleRate)
+			continue;
+
+		double x = size.left + frequencyToX(splitF[i], width);
+		pContext->drawLine(CPoint(x, size.top + frameWidth), CPoint(x, size.bottom - frameWidth));
+	}
+
+	if (preColumns.size() == 0)
+		return;
+
+	// --- pre: filled, semi-transparent
+	pContext->setFrameColor(CColor(160, 160, 160, 120));
+	for (size_t x = 0; x < preColumns.size(); x++)
+	{
+		if (columnBinLo[x] < 0)
+			break;
+
+		double y = size.top + dBToY(preColumns[x], height);
+		pContext->drawLine(CPoint(size.left + x, size.bottom - frameWidth), CPoint(size.left + x, y));
+	}
+
+	// --- post: line
+	pContext->setFrameColor(CColor(32, 200, 255, 255));
+	CPoint lastPoint(size.left, size.top + dBToY(postColumns[0], height));
+	for (size_t x = 1; x < postColumns.size(); x++)
+	{
+		if (columnBinLo[x] < 0)
+			break;
+
+		const CPoint p2(size.left + x, size.top + dBToY(postColumns[x], height));
+		pContext->drawLine(lastPoint, p2);
+		lastPoint = p2;
+	}
+}
+
 #endif
 
 /**
@@ -17,6 +17,9 @@
 #include "vstgui/vstgui_uidescription.h" // for IController
 
 #include "../PluginKernel/pluginstructures.h"
+#include "../PluginObjects/fxobjects.h"
+
+#include <vector>
 
 namespace VSTGUI {
 
@@ -36,6 +39,9 @@ WaveView:
 the data queue and adds that to the waveform buffer (circular)
 - uses a circular buffer to make waveform appear to scroll
 - each new input point pushes oldest sample out of the buffer
+- optionally (setNumTraces()) the circular buffer holds a min/max pair per trace for each column;
+in this mode only the new columns are rendered, into an offscreen bitmap whose columns
+follow the circular buffer, and draw() just blits the bitmap in two pieces
 
 \author Will Pirkle http://www.willpirkle.com
 \remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
@@ -68,6 +74,30 @@ public:
 	*/
 	void showXAxis(bool _paintXAxis) { paintXAxis = _paintXAxis; }
 
+	/** switch to multi-trace min/max mode; re-allocates and clears the circular buffer
+	\param _numTraces number of traces; 0 returns to the single waveform mode
+	*/
+	void setNumTraces(int _numTraces);
+
+	/** set a trace's color for multi-trace mode
+	\param trace trace index
+	\param color the trace color
+	*/
+	void setTraceColor(int trace, const CColor& color);
+
+	/** set one trace's values for the next column; call advanceColumn() after all traces are set
+	\param trace trace index
+	\param top top of the trace's line, as a fraction of the view height (0 = top, 1 = bottom)
+	\param bottom bottom of the trace's line, as a fraction of the view height
+	*/
+	void setTraceDataPoint(int trace, float top, float bottom);
+
+	/** move the multi-trace write location to the next column */
+	void advanceColumn();
+
+	/** render any new multi-trace columns into the offscreen bitmap and invalidate the view */
+	void renderNewColumns();
+
 	/** override of drawing function
 	\param pContext incoming draw context
 	*/
@@ -81,18 +111,208 @@ protected:
     bool paintXAxis = true; ///< flag for painting X Axis
 
     // --- circular buffer and index values
-    double* circularBuffer = nullptr;	///< circular buffer to store peak values
+    double* circularBuffer = nullptr;	///< circular buffer to store peak values; or [column][trace][top, bottom] in multi-trace mode
     int writeIndex = 0;		///< circular buffer write location
     int readIndex = 0;		///< circular buffer read location
     int circularBufferLength = 0;///< circular buffer length
 	CRect currentRect;		///< the rect to draw into
 
+	// --- multi-trace mode
+	int numTraces = 0;					///< 0 = single waveform mode
+	std::vector<CColor> traceColors;	///< per-trace line colors
+	int pendingColumns = 0;				///< columns added since the last renderNewColumns()
+	SharedPointer<COffscreenContext> offscreen; ///< rendered columns, same column order as the circular buffer
+
+	/** draw one column of all traces */
+	void drawColumn(CDrawContext* pContext, int column, CCoord x, CCoord top, CCoord height);
+
 private:
     // --- lock-free queue for incoming data, sized to DATA_QUEUE_LEN in length
     moodycamel::ReaderWriterQueue<double, DATA_QUEUE_LEN>* dataQueue = nullptr; ///< lock-free queue for incoming data, sized to DATA_QUEUE_LEN in length
 
 };
 
+// --- gain reduction history incoming queue length; ~1.3 seconds of GR_HISTORY_INTERVAL_MSEC columns
+const int GR_QUEUE_LEN = 128;
+
+/**
+\class GainReductionView
+\ingroup Custom-Views
+\brief
+This object displays a scrolling history of the gain reduction of all six dynamics processors.\n
+
+GainReductionView:
+- the plugin core sends one GainReductionDataBlock (min/max gain per processor) per
+GR_HISTORY_INTERVAL_MSEC with ICustomView::sendMessage(); it is copied into a lock-free queue
+- updateView() drains the queue, converts the gains to dB and adds one WaveView column per block
+- uses the WaveView multi-trace mode, so only the new columns are rendered each frame
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 18
+*/
+class GainReductionView : public WaveView
+{
+public:
+	GainReductionView(const CRect& size, IControlListener* listener, int32_t tag);
+	~GainReductionView();
+
+	/** ICustomView method: add any new columns and repaint the control */
+	virtual void updateView() override;
+
+	/** ICustomView method: data is a GainReductionDataBlock*; it is copied into the queue */
+	virtual void sendMessage(void* data) override;
+
+	/** set the reduction at the bottom of the view
+	\param _rangeDB range in dB, e.g. -24.0
+	*/
+	void setRange(double _rangeDB) { rangeDB = _rangeDB; }
+
+	// --- for CControl pure abstract functions
+	CLASS_METHODS(GainReductionView, WaveView)
+
+protected:
+	double rangeDB = -24.0; ///< reduction at the bottom of the view
+
+	/** linear gain to fraction of the view height */
+	float gainToFraction(float gain);
+
+private:
+	// --- lock-free queue for incoming blocks
+	moodycamel::ReaderWriterQueue<GainReductionDataBlock, GR_QUEUE_LEN>* dataQueue = nullptr; ///< lock free queue
+};
+
+// --- transfer curve and crossover response grid size, and incoming queue length
+const int RESPONSE_POINTS = 512;
+const int RESPONSE_QUEUE_LEN = 16;
+
+/**
+\class TransferCurveView
+\ingroup Custom-Views
+\brief
+This object displays the static transfer curve of one dynamics processor with a live dot at the current detector level.\n
+
+TransferCurveView:
+- the plugin core sends DynamicsCurveData with ICustomView::sendMessage(); it is copied into a lock-free queue
+- the RESPONSE_POINTS curve is evaluated with DynamicsProcessor::computeTransferCurve() on a GUI-side
+processor, and only when the curve settings change
+- between changes only the live dot moves; it invalidates just the old and new dot rectangles
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 18
+*/
+class TransferCurveView : public CControl, public ICustomView
+{
+public:
+	TransferCurveView(const CRect& size, IControlListener* listener, int32_t tag);
+	~TransferCurveView();
+
+	/** ICustomView method: update the curve and dot and repaint what changed */
+	virtual void updateView() override;
+
+	/** ICustomView method: data is a DynamicsCurveData*; it is copied into the queue */
+	virtual void sendMessage(void* data) override;
+
+	/** override to draw, called if the view should draw itself*/
+	void draw(CDrawContext* pContext) override;
+
+	/** set the lowest level on both axes
+	\param _minDB level in dB, e.g. -60.0
+	*/
+	void setRange(double _minDB);
+
+	// --- for CControl pure abstract functions
+	CLASS_METHODS(TransferCurveView, CControl)
+
+protected:
+	double minDB = -60.0;						///< left/bottom of the plot; right/top is 0dB
+
+	DynamicsProcessor processor;				///< GUI-side processor, only used for the static curve
+	DynamicsCurveData curveData;				///< settings of the current curve
+	bool curveValid = false;					///< curve has been computed
+
+	double inputGrid[RESPONSE_POINTS] = { 0.0 };	///< input levels in dB
+	double outputCurve[RESPONSE_POINTS] = { 0.0 };	///< output levels in dB
+
+	double detect_dB = -96.0;					///< live dot level
+	CRect dotRect;								///< live dot, last drawn location
+
+	/** true if the new data changes the curve */
+	bool curveChanged(const DynamicsCurveData& data);
+
+	/** evaluate the curve */
+	void computeCurve();
+
+	/** the dot rectangle for a detector level */
+	CRect getDotRect(double level_dB);
+
+	/** level to x or y offset */
+	double levelToOffset(double level_dB, double length);
+
+private:
+	// --- lock-free queue for incoming data
+	moodycamel::ReaderWriterQueue<DynamicsCurveData, RESPONSE_QUEUE_LEN>* dataQueue = nullptr; ///< lock free queue
+};
+
+/**
+\class CrossoverResponseView
+\ingroup Custom-Views
+\brief
+This object displays the magnitude responses of the four crossover bands.\n
+
+CrossoverResponseView:
+- the plugin core sends CrossoverResponseData with ICustomView::sendMessage(); it is copied into a lock-free queue
+- GUI-side LRFilterBank objects are set to the split frequencies and their Biquad coefficients are
+evaluated with the batch getMagResponse() over a RESPONSE_POINTS log-frequency grid
+- the cos(theta) grid is only rebuilt on a sample rate change and the responses only when a split changes
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 18
+*/
+class CrossoverResponseView : public CControl, public ICustomView
+{
+public:
+	CrossoverResponseView(const CRect& size, IControlListener* listener, int32_t tag);
+	~CrossoverResponseView();
+
+	/** ICustomView method: update the responses and repaint if they changed */
+	virtual void updateView() override;
+
+	/** ICustomView method: data is a CrossoverResponseData*; it is copied into the queue */
+	virtual void sendMessage(void* data) override;
+
+	/** override to draw, called if the view should draw itself*/
+	void draw(CDrawContext* pContext) override;
+
+	// --- for CControl pure abstract functions
+	CLASS_METHODS(CrossoverResponseView, CControl)
+
+protected:
+	CrossoverResponseData responseData;					///< settings of the current responses
+	bool responseValid = false;							///< responses have been computed
+
+	LRFilterBank filterBank[3];							///< GUI-side splitters, one per split frequency
+	double cosTheta[RESPONSE_POINTS] = { 0.0 };			///< cos(theta) for each grid frequency
+	double lfMag[RESPONSE_POINTS] = { 0.0 };			///< scratch: LF magnitude of one splitter
+	double hfMag[RESPONSE_POINTS] = { 0.0 };			///< scratch: HF magnitude of one splitter
+	double bandMag[4][RESPONSE_POINTS] = { { 0.0 } };	///< band magnitudes, then dB
+
+	/** rebuild the cos(theta) grid for a new sample rate */
+	void updateGrid();
+
+	/** evaluate the band responses */
+	void computeResponses();
+
+	/** dB to y offset */
+	double dBToY(double dB, double height);
+
+private:
+	// --- lock-free queue for incoming data
+	moodycamel::ReaderWriterQueue<CrossoverResponseData, RESPONSE_QUEUE_LEN>* dataQueue = nullptr; ///< lock free queue
+};
+
 #ifdef HAVE_FFTW
 // --- FFTW (REQUIRED)
 #include "fftw3.h"
@@ -172,12 +392,10 @@ protected:
     //     implementation but you may need it for homework/upgrading the object
 	spectrumViewWindowType window = spectrumViewWindowType::kRectWindow; ///< window type
 
-    // --- setup FFTW
-    fftw_complex* data = nullptr;			///< fft input data
-	fftw_complex* fft_result = nullptr;		///< fft output data
-	fftw_complex* ifft_result = nullptr;	///< ifft output (not used)
-	fftw_plan plan_forward;					///< plan for FFT
-	fftw_plan plan_backward;				///< plan for IFFT (not used)
+    // --- setup FFTW; the r2c plan is shared through the FFTPlanRegistry
+    double* data = nullptr;					///< fft input data
+	fftw_complex* fft_result = nullptr;		///< fft output data, FFT_LEN/2 + 1 bins
+	fftw_plan plan_forward = nullptr;		///< r2c plan for FFT
 
     // --- for FFT data input
     int fftInputCounter = 0;				///< input counter for FFT
@@ -279,6 +497,95 @@ private:
     moodycamel::ReaderWriterQueue<double*,2>* fftMagBuffersReady = nullptr; ///< example of queuing system (yes I know it is overkill here)
     moodycamel::ReaderWriterQueue<double*,2>* fftMagBuffersEmpty = nullptr; ///< example of queuing system (yes I know it is overkill here)
 };
+
+// --- per-band analyzer FFT length (power of 2) and incoming block queue length
+const int ANALYZER_FFT_LEN = 2048;
+const int ANALYZER_QUEUE_LEN = 64;
+
+/**
+\class BandSpectrumView
+\ingroup Custom-Views
+\brief
+This object displays the pre- and post-compression spectrum of one band along with the crossover markers.\n
+
+BandSpectrumView:
+- the plugin core sends AnalyzerDataBlock structures with ICustomView::sendMessage(); these are
+copied into a lock-free queue and nothing else is done on the audio thread
+- updateView() runs on the GUI timer: it drains the queue into a history of the last
+ANALYZER_FFT_LEN samples and computes the windowed real FFTs for both traces
+- the r2c plan comes from the FFTPlanRegistry and is re-used for every frame and for both traces
+- magnitudes are reduced to one dB value per pixel column on a log frequency axis;
+the bin ranges for the columns are only recalculated when the width or sample rate changes
+- the pre trace is drawn filled, the post trace as a line over it
+- this is separate from SpectrumView, which analyzes one trace pushed a sample at a time at the full
+rate, normalizes it to its own peak and plots linear bins; here the two traces must share one window
+position at the band's decimated rate and be drawn in absolute dB so that the gain reduction shows
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 18
+*/
+class BandSpectrumView : public CControl, public ICustomView
+{
+public:
+	BandSpectrumView(const CRect& size, IControlListener* listener, int32_t tag);
+	~BandSpectrumView();
+
+	/** ICustomView method: analyze any new data and repaint the control */
+	virtual void updateView() override;
+
+	/** ICustomView method: data is an AnalyzerDataBlock*; it is copied into the queue */
+	virtual void sendMessage(void* data) override;
+
+	/** override to draw, called if the view should draw itself*/
+	void draw(CDrawContext* pContext) override;
+
+	// --- for CControl pure abstract functions
+	CLASS_METHODS(BandSpectrumView, CControl)
+
+protected:
+	// --- GUI thread history of the most recent samples
+	double preHistory[ANALYZER_FFT_LEN] = { 0.0 };	///< pre-processing history (circular)
+	double postHistory[ANALYZER_FFT_LEN] = { 0.0 };	///< post-processing history (circular)
+	int historyWriteIndex = 0;						///< history write location
+
+	double sampleRate = 44100.0;					///< sample rate of the incoming data
+	double splitF[3] = { 0.0, 0.0, 0.0 };			///< crossover markers
+
+	// --- FFTW
+	double* fftInput = nullptr;						///< windowed input
+	fftw_complex* fftOutput = nullptr;				///< ANALYZER_FFT_LEN/2 + 1 bins
+	fftw_plan plan_forward = nullptr;				///< r2c plan from the FFTPlanRegistry, shared by both traces
+	double fftWindow[ANALYZER_FFT_LEN] = { 0.0 };	///< Blackman-Harris window
+	double windowScale = 1.0;						///< 2/sum(window): full scale sine = 0dB
+	float binMagnitude[ANALYZER_FFT_LEN / 2 + 1] = { 0.f }; ///< scratch magnitudes
+
+	// --- one dB value per pixel column
+	std::vector<float> preColumns;					///< pre trace
+	std::vector<float> postColumns;					///< post trace
+	std::vector<int> columnBinLo;					///< first FFT bin for each column; -1 = above Nyquist
+	std::vector<int> columnBinHi;					///< one past the last FFT bin for each column
+	double columnSampleRate = 0.0;					///< sample rate the column map was made for
+
+	/** recalculate the column to bin map */
+	void updateColumnMap();
+
+	/** FFT the history and fold it into the columns with a falling decay */
+	void analyze(const double* history, std::vector<float>& columns);
+
+	/** frequency to x-offset on the log frequency axis */
+	double frequencyToX(double frequency, double width);
+
+	/** dB to y-offset */
+	double dBToY(double dB, double height);
+
+	/** reusable block for dequeueing */
+	AnalyzerDataBlock incomingBlock;
+
+private:
+	// --- lock-free queue for incoming blocks
+	moodycamel::ReaderWriterQueue<AnalyzerDataBlock, ANALYZER_QUEUE_LEN>* dataQueue = nullptr; ///< lock free queue
+};
 #endif // defined FFTW
 
 
@@ -121,6 +121,8 @@ void PluginBase::syncInBoundVariables()
 \brief THE buffer processing function.
 
 Operation:
+- set the FPU to flush denormals to zero (ScopedDenormalGuard) for the duration of the buffer
+- mark the buffer as the audio callback for the real-time safety checker (ScopedRealtimeCheck; compiled out by default)
 - break channel buffers into frames (one sample from each channel, in and out)
 - call the pre-processing function on derived class to allow it to prepare for the audio buffer's arrival
 - call the frame processing function that the derived class MUST implement repeatedly until the buffer is processed
@@ -133,6 +135,12 @@ Operation:
 */
 bool PluginBase::processAudioBuffers(ProcessBufferInfo& processBufferInfo)
 {
+	// --- flush denormals to zero for this buffer; the previous FPU mode is restored on return
+	ScopedDenormalGuard denormalGuard;
+
+	// --- with ASPIK_REALTIME_CHECK (Linux), flag allocations, locks and system calls made in this buffer
+	ScopedRealtimeCheck realtimeCheck;
+
 	memset(&inputFrame, 0, sizeof(float)*MAX_CHANNEL_COUNT);
 	memset(&outputFrame, 0, sizeof(float)*MAX_CHANNEL_COUNT);
 	memset(&auxInputFrame, 0, sizeof(float)*MAX_CHANNEL_COUNT);
@@ -193,9 +193,77 @@ The AAX plugin shell consists of the following files:
 #define __PluginBase__
 
 #include "pluginparameter.h"
+#include "realtimecheck.h"
 
 #include <map>
 
+// --- for the denormal guard
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#include <xmmintrin.h>
+#define ASPIK_DENORMALS_X86
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+#define ASPIK_DENORMALS_ARM64
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__arm__) && defined(__VFP_FP__) && !defined(__SOFTFP__)
+#define ASPIK_DENORMALS_ARM32
+#endif
+
+/**
+\class ScopedDenormalGuard
+\ingroup ASPiK-Core
+\brief
+Sets the FPU to flush denormals to zero for the lifetime of the object, then restores the previous mode.
+
+- x86/x64: sets FTZ and DAZ in the MXCSR register
+- ARM: sets FZ in the FPCR (64 bit) or FPSCR (32 bit) register
+- other targets: does nothing
+
+PluginBase::processAudioBuffers( ) creates one on the stack so the whole buffer (including the
+pre- and post-processing functions) runs with denormals flushed; if you override processAudioBuffers( )
+in your PluginCore, declare one at the top of your version.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 18
+*/
+class ScopedDenormalGuard
+{
+public:
+	ScopedDenormalGuard()
+	{
+#if defined(ASPIK_DENORMALS_X86)
+		previousState = _mm_getcsr();
+		_mm_setcsr((unsigned int)previousState | 0x8040); // FTZ (bit 15) | DAZ (bit 6)
+#elif defined(ASPIK_DENORMALS_ARM64)
+		uint64_t fpcr = 0;
+		asm volatile("mrs %0, fpcr" : "=r"(fpcr));
+		previousState = fpcr;
+		asm volatile("msr fpcr, %0" : : "r"(fpcr | (1ULL << 24))); // FZ (bit 24)
+#elif defined(ASPIK_DENORMALS_ARM32)
+		uint32_t fpscr = 0;
+		asm volatile("vmrs %0, fpscr" : "=r"(fpscr));
+		previousState = fpscr;
+		asm volatile("vmsr fpscr, %0" : : "r"(fpscr | (1U << 24))); // FZ (bit 24)
+#endif
+	}
+
+	~ScopedDenormalGuard()
+	{
+#if defined(ASPIK_DENORMALS_X86)
+		_mm_setcsr((unsigned int)previousState);
+#elif defined(ASPIK_DENORMALS_ARM64)
+		asm volatile("msr fpcr, %0" : : "r"(previousState));
+#elif defined(ASPIK_DENORMALS_ARM32)
+		asm volatile("vmsr fpscr, %0" : : "r"((uint32_t)previousState));
+#endif
+	}
+
+	ScopedDenormalGuard(const ScopedDenormalGuard&) = delete;
+	ScopedDenormalGuard& operator=(const ScopedDenormalGuard&) = delete;
+
+private:
+	uint64_t previousState = 0; ///< register contents to restore
+};
+
 /**
 \class PluginBase
 \ingroup ASPiK-Core
@@ -1212,6 +1212,39 @@ bool PluginCore::initPluginParameters()
 
 
 	// **--0xEDA5--**
+
+	// --- preset morph controls
+	// --- continuous control: A/B Morph
+	piParam = new PluginParameter(morphControlID::presetMorph, "A/B Morph", "", controlVariableType::kDouble, 0.000000, 1.000000, 0.000000, taper::kLinearTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&presetMorph, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- continuous control: Morph Time
+	piParam = new PluginParameter(morphControlID::morphTime_ms, "Morph Time", "ms", controlVariableType::kDouble, 0.000000, 5000.000000, 250.000000, taper::kAntiLogTaper);
+	piParam->setParameterSmoothing(false);
+	piParam->setSmoothingTimeMsec(100.00);
+	piParam->setBoundVariable(&morphTime_ms, boundVariableType::kDouble);
+	addPluginParameter(piParam);
+
+	// --- discrete control: Enable Morph
+	piParam = new PluginParameter(morphControlID::enableMorph, "Enable Morph", "SWITCH OFF,SWITCH ON", "SWITCH OFF");
+	piParam->setBoundVariable(&enableMorph, boundVariableType::kInt);
+	piParam->setIsDiscreteSwitch(true);
+	addPluginParameter(piParam);
+
+	// --- discrete control: Store A
+	piParam = new PluginParameter(morphControlID::storeMorphA, "Store A", "SWITCH OFF,SWITCH ON", "SWITCH OFF");
+	piParam->setBoundVariable(&storeMorphA, boundVariableType::kInt);
+	piParam->setIsDiscreteSwitch(true);
+	addPluginParameter(piParam);
+
+	// --- discrete control: Store B
+	piParam = new PluginParameter(morphControlID::storeMorphB, "Store B", "SWITCH OFF,SWITCH ON", "SWITCH OFF");
+	piParam->setBoundVariable(&storeMorphB, boundVariableType::kInt);
+	piParam->setIsDiscreteSwitch(true);
+	addPluginParameter(piParam);
    
     // --- BONUS Parameter
     // --- SCALE_GUI_SIZE
@@ -1382,6 +1415,39 @@ void PluginCore::updateParameters()
 
 	params.masterOutputVolume = masterOutput;
 
+	// --- A/B morph: the store switches capture the live settings on their rising edge
+	int storeMorph[2] = { storeMorphA, storeMorphB };
+	for (int i = 0; i < 2; i++)
+	{
+		if (storeMorph[i] && !lastStoreMorph[i])
+		{
+			if (i == 0)
+				morphSnapshotA = params;
+			else
+				morphSnapshotB = params;
+
+			morphSnapshotsValid[i] = true;
+			fourBandDynamics.setMorphSnapshots(morphSnapshotA, morphSnapshotB);
+		}
+		lastStoreMorph[i] = storeMorph[i];
+	}
+
+	// --- while morphing, the snapshots drive the object instead of the controls
+	bool morphing = enableMorph && morphSnapshotsValid[0] && morphSnapshotsValid[1];
+	fourBandDynamics.enableMorph(morphing);
+	if (morphing)
+	{
+		fourBandDynamics.setMorphAmount(presetMorph, morphTime_ms);
+		return;
+	}
+
+	// --- glide into a newly loaded preset rather than jumping
+	if (presetLoadPending)
+	{
+		fourBandDynamics.morphToParameters(params, morphTime_ms);
+		presetLoadPending = false;
+		return;
+	}
 
 	fourBandDynamics.setParameters(params);
 }
@@ -1417,26 +1483,9 @@ bool PluginCore::processAudioFrame(ProcessFrameInfo& processFrameInfo)
 	if (processed)
 	{
 		FourBandDynamicsParameters params = fourBandDynamics.getParameters();
-
-		inputMeter1 = params.inputMeter[0];
-		inputMeter2 = params.inputMeter[1];
-		inputMeter3 = params.inputMeter[2];
-		inputMeter4 = params.inputMeter[3];
-
-		outputMeter1 = params.outputMeter[0];
-		outputMeter2 = params.outputMeter[1];
-		outputMeter3 = params.outputMeter[2];
-		outputMeter4 = params.outputMeter[3];
-
-		reductionMeter1 = params.reductionMeter[0];
-		reductionMeter2 = params.reductionMeter[1];
-		reductionMeter3 = params.reductionMeter[2];
-		reductionMeter4 = params.reductionMeter[3];
-		midReductionMeter = params.reductionMeter[4];
-		sideReductionMeter = params.reductionMeter[5];
-
-		masterInputMeter = params.masterInputMeter;
-		masterOutputMeter = params.masterOutputMeter;
+		holdMeterPeaks(params);
+		feedAnalyzers(params);
+		feedGainReductionHistory(params);
 	}
 
 	return processed;
@@ -1459,9 +1508,178 @@ bool PluginCore::postProcessAudioBuffers(ProcessBufferInfo& processInfo)
 	//     in the future
 	updateOutBoundVariables();
 
+	// --- start the next buffer's peak hold
+	resetMeterPeaks();
+
+	// --- curve settings and detector levels for the response views
+	feedResponseViews(processInfo.numFramesToProcess);
+
+	// --- close this buffer's stage timings (FOURBAND_DYNAMICS_PROFILING builds; a no-op otherwise)
+	fourBandDynamics.endProfileBlock();
+
     return true;
 }
 
+/**
+\brief hold the per-buffer peak of each meter; the GUI reads the meters once per buffer
+       so a per-frame value would be whatever sample happened to end the buffer
+
+\param params the dynamics object's parameters, holding this frame's meter values
+*/
+void PluginCore::holdMeterPeaks(const FourBandDynamicsParameters& params)
+{
+	inputMeter1 = fmax(inputMeter1, fabs(params.inputMeter[0]));
+	inputMeter2 = fmax(inputMeter2, fabs(params.inputMeter[1]));
+	inputMeter3 = fmax(inputMeter3, fabs(params.inputMeter[2]));
+	inputMeter4 = fmax(inputMeter4, fabs(params.inputMeter[3]));
+
+	outputMeter1 = fmax(outputMeter1, fabs(params.outputMeter[0]));
+	outputMeter2 = fmax(outputMeter2, fabs(params.outputMeter[1]));
+	outputMeter3 = fmax(outputMeter3, fabs(params.outputMeter[2]));
+	outputMeter4 = fmax(outputMeter4, fabs(params.outputMeter[3]));
+
+	reductionMeter1 = fmax(reductionMeter1, params.reductionMeter[0]);
+	reductionMeter2 = fmax(reductionMeter2, params.reductionMeter[1]);
+	reductionMeter3 = fmax(reductionMeter3, params.reductionMeter[2]);
+	reductionMeter4 = fmax(reductionMeter4, params.reductionMeter[3]);
+	midReductionMeter = fmax(midReductionMeter, params.reductionMeter[4]);
+	sideReductionMeter = fmax(sideReductionMeter, params.reductionMeter[5]);
+
+	masterInputMeter = fmax(masterInputMeter, fabs(params.masterInputMeter));
+	masterOutputMeter = fmax(masterOutputMeter, fabs(params.masterOutputMeter));
+}
+
+/**
+\brief send the band's pre- and post-compression signals to the registered analyzer views; the
+       signals are averaged down to the band's decimated rate and sent a block at a time, the
+       views copy the blocks into lock-free queues and do all of the analysis on the GUI thread
+
+\param params the dynamics object's parameters, holding this frame's band signals
+*/
+void PluginCore::feedAnalyzers(const FourBandDynamicsParameters& params)
+{
+	for (uint32_t band = 0; band < 4; band++)
+	{
+		if (!bandSpectrumView[band])
+			continue;
+
+		// --- boxcar average down to the band's analysis rate
+		analyzerAccum[band][0] += params.analyzerPre[band];
+		analyzerAccum[band][1] += params.analyzerPost[band];
+		if (++analyzerDecimationCount[band] < analyzerDecimation[band])
+			continue;
+
+		AnalyzerDataBlock& block = analyzerBlock[band];
+		double scale = 1.0 / analyzerDecimation[band];
+		block.pre[block.count] = (float)(analyzerAccum[band][0] * scale);
+		block.post[block.count] = (float)(analyzerAccum[band][1] * scale);
+		analyzerAccum[band][0] = 0.0;
+		analyzerAccum[band][1] = 0.0;
+		analyzerDecimationCount[band] = 0;
+
+		if (++block.count < ANALYZER_BLOCK_LEN)
+			continue;
+
+		block.sampleRate = getSampleRate() / analyzerDecimation[band];
+		for (int i = 0; i < 3; i++)
+			block.splitF[i] = params.splitF[i];
+
+		bandSpectrumView[band]->sendMessage(&block);
+		block.count = 0;
+	}
+}
+
+/**
+\brief track the min/max gain of each dynamics processor and send one pair per processor to the
+       gain reduction history view every GR_HISTORY_INTERVAL_MSEC
+
+\param params the dynamics object's parameters, holding this frame's reduction meters
+*/
+void PluginCore::feedGainReductionHistory(const FourBandDynamicsParameters& params)
+{
+	if (!gainReductionView)
+		return;
+
+	// --- reductionMeter = 1 - gain
+	for (uint32_t i = 0; i < GR_HISTORY_TRACES; i++)
+	{
+		float gain = 1.f - params.reductionMeter[i];
+		gainReductionBlock.gainMin[i] = fmin(gainReductionBlock.gainMin[i], gain);
+		gainReductionBlock.gainMax[i] = fmax(gainReductionBlock.gainMax[i], gain);
+	}
+
+	if (++gainReductionCount < (uint32_t)(getSampleRate()*GR_HISTORY_INTERVAL_MSEC*0.001))
+		return;
+
+	gainReductionView->sendMessage(&gainReductionBlock);
+
+	for (uint32_t i = 0; i < GR_HISTORY_TRACES; i++)
+	{
+		gainReductionBlock.gainMin[i] = 1.f;
+		gainReductionBlock.gainMax[i] = 0.f;
+	}
+	gainReductionCount = 0;
+}
+
+/**
+\brief send the dynamics curve settings with the current detector levels, and the crossover settings,
+       to the registered response views every RESPONSE_VIEW_INTERVAL_MSEC; the views only recompute
+       their curves when the settings change
+
+\param numFrames the number of frames in the buffer that was just processed
+*/
+void PluginCore::feedResponseViews(uint32_t numFrames)
+{
+	responseViewCount += numFrames;
+	if (responseViewCount < (uint32_t)(getSampleRate()*RESPONSE_VIEW_INTERVAL_MSEC*0.001))
+		return;
+	responseViewCount = 0;
+
+	for (uint32_t i = 0; i < 6; i++)
+	{
+		if (!transferCurveView[i])
+			continue;
+
+		DynamicsProcessorParameters params = fourBandDynamics.getDynamicsParameters(i);
+
+		DynamicsCurveData curveData;
+		curveData.threshold_dB = params.threshold_dB;
+		curveData.ratio = params.ratio;
+		curveData.kneeWidth_dB = params.kneeWidth_dB;
+		curveData.outputGain_dB = params.outputGain_dB;
+		curveData.softKnee = params.softKnee;
+		curveData.hardLimitGate = params.hardLimitGate;
+		curveData.expander = params.calculation == dynamicsProcessorType::kDownwardExpander;
+		curveData.detect_dB = params.detect_dB;
+
+		transferCurveView[i]->sendMessage(&curveData);
+	}
+
+	if (crossoverResponseView)
+	{
+		FourBandDynamicsParameters params = fourBandDynamics.getParameters();
+
+		CrossoverResponseData responseData;
+		responseData.sampleRate = getSampleRate();
+		for (int i = 0; i < 3; i++)
+			responseData.splitF[i] = params.splitF[i];
+
+		crossoverResponseView->sendMessage(&responseData);
+	}
+}
+
+/**
+\brief clear the meter peak hold after the meters have been sent to the GUI
+*/
+void PluginCore::resetMeterPeaks()
+{
+	inputMeter1 = inputMeter2 = inputMeter3 = inputMeter4 = 0.f;
+	outputMeter1 = outputMeter2 = outputMeter3 = outputMeter4 = 0.f;
+	reductionMeter1 = reductionMeter2 = reductionMeter3 = reductionMeter4 = 0.f;
+	midReductionMeter = sideReductionMeter = 0.f;
+	masterInputMeter = masterOutputMeter = 0.f;
+}
+
 /**
 \brief update the PluginParameter's value based on GUI control, preset, or data smoothing (thread-safe)
 
@@ -1539,6 +1757,10 @@ bool PluginCore::postUpdatePluginParameter(int32_t controlID, double controlValu
             return false;   /// not handled
     }*/
 
+	// --- flag preset loads so the next update glides to the new settings
+	if (paramInfo.loadingPreset)
+		presetLoadPending = true;
+
     return false;
 }
 
@@ -1602,18 +1824,98 @@ bool PluginCore::processMessage(MessageInfo& messageInfo)
 	// --- NULL pointers so that we don't accidentally use them
 	case PLUGINGUI_WILLCLOSE:
 	{
+		for (uint32_t band = 0; band < 4; band++)
+			bandSpectrumView[band] = nullptr;
+		gainReductionView = nullptr;
+		crossoverResponseView = nullptr;
+		for (uint32_t i = 0; i < 6; i++)
+			transferCurveView[i] = nullptr;
+
 		return false;
 	}
 
 	// --- update view; this will only be called if the GUI is actually open
 	case PLUGINGUI_TIMERPING:
 	{
+		// --- the analysis runs here, on the GUI thread
+		for (uint32_t band = 0; band < 4; band++)
+		{
+			if (bandSpectrumView[band])
+				bandSpectrumView[band]->updateView();
+		}
+
+		if (gainReductionView)
+			gainReductionView->updateView();
+
+		for (uint32_t i = 0; i < 6; i++)
+		{
+			if (transferCurveView[i])
+				transferCurveView[i]->updateView();
+		}
+
+		if (crossoverResponseView)
+			crossoverResponseView->updateView();
+
 		return false;
 	}
 
 	// --- register the custom view, grab the ICustomView interface
 	case PLUGINGUI_REGISTER_CUSTOMVIEW:
 	{
+		// --- per-band analyzers
+		for (uint32_t band = 0; band < 4; band++)
+		{
+			if (messageInfo.inMessageString.compare("BandSpectrumView" + std::to_string(band + 1)) == 0)
+			{
+				bandSpectrumView[band] = static_cast<ICustomView*>(messageInfo.inMessageData);
+				return true;
+			}
+		}
+
+		if (messageInfo.inMessageString.compare("GainReductionView") == 0)
+		{
+			gainReductionView = static_cast<ICustomView*>(messageInfo.inMessageData);
+			return true;
+		}
+
+		// --- transfer curves: bands 1-4, then mid and side
+		for (uint32_t i = 0; i < 6; i++)
+		{
+			if (messageInfo.inMessageString.compare("TransferCurveView" + std::to_string(i + 1)) == 0)
+			{
+				transferCurveView[i] = static_cast<ICustomView*>(messageInfo.inMessageData);
+				return true;
+			}
+		}
+
+		if (messageInfo.inMessageString.compare("CrossoverResponseView") == 0)
+		{
+			crossoverResponseView = static_cast<ICustomView*>(messageInfo.inMessageData);
+			return true;
+		}
+
+		return false;
+	}
+
+	case PLUGINGUI_DE_REGISTER_CUSTOMVIEW:
+	{
+		for (uint32_t band = 0; band < 4; band++)
+		{
+			if (bandSpectrumView[band] == static_cast<ICustomView*>(messageInfo.inMessageData))
+				bandSpectrumView[band] = nullptr;
+		}
+
+		if (gainReductionView == static_cast<ICustomView*>(messageInfo.inMessageData))
+			gainReductionView = nullptr;
+
+		for (uint32_t i = 0; i < 6; i++)
+		{
+			if (transferCurveView[i] == static_cast<ICustomView*>(messageInfo.inMessageData))
+				transferCurveView[i] = nullptr;
+		}
+
+		if (crossoverResponseView == static_cast<ICustomView*>(messageInfo.inMessageData))
+			crossoverResponseView = nullptr;
 
 		return false;
 	}
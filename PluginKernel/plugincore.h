@@ -125,6 +125,15 @@ enum controlID {
 
 	// **--0x0F1F--**
 
+// --- preset morph controls; kept outside the generated block above
+enum morphControlID {
+	presetMorph = 160,
+	morphTime_ms = 161,
+	enableMorph = 162,
+	storeMorphA = 163,
+	storeMorphB = 164
+};
+
 /**
 \class PluginCore
 \ingroup ASPiK-Core
@@ -206,6 +215,42 @@ public:
 	FourBandDynamics fourBandDynamics;
 	void updateParameters();
 
+	// --- preset morph: A/B position, glide time and snapshot switches
+	double presetMorph = 0.0;
+	double morphTime_ms = 0.0;
+	int enableMorph = 0;
+	int storeMorphA = 0;
+	int storeMorphB = 0;
+
+	FourBandDynamicsParameters morphSnapshotA;	///< A/B morph snapshots, captured from the live controls
+	FourBandDynamicsParameters morphSnapshotB;
+	bool morphSnapshotsValid[2] = { false, false };
+	int lastStoreMorph[2] = { 0, 0 };			///< for edge-detecting the store switches
+	bool presetLoadPending = false;				///< glide to the next parameter update
+
+	// --- meters hold the peak over each buffer; the GUI only reads one value per buffer
+	void holdMeterPeaks(const FourBandDynamicsParameters& params);
+	void resetMeterPeaks();
+
+	// --- per-band spectrum analyzers (GUI custom views BandSpectrumView1 ... BandSpectrumView4)
+	void feedAnalyzers(const FourBandDynamicsParameters& params);
+	ICustomView* bandSpectrumView[4] = { nullptr, nullptr, nullptr, nullptr };
+	AnalyzerDataBlock analyzerBlock[4];				///< blocks being filled on the audio thread
+	double analyzerAccum[4][2] = { { 0.0 } };		///< pre/post decimation accumulators
+	uint32_t analyzerDecimationCount[4] = { 0, 0, 0, 0 };
+	const uint32_t analyzerDecimation[4] = { 4, 2, 1, 1 };	///< low bands need less bandwidth
+
+	// --- gain reduction history (GUI custom view GainReductionView)
+	void feedGainReductionHistory(const FourBandDynamicsParameters& params);
+	ICustomView* gainReductionView = nullptr;
+	GainReductionDataBlock gainReductionBlock;		///< min/max being accumulated on the audio thread
+	uint32_t gainReductionCount = 0;				///< samples accumulated into gainReductionBlock
+
+	// --- transfer curve (TransferCurveView1 ... TransferCurveView6) and crossover response (CrossoverResponseView) views
+	void feedResponseViews(uint32_t numFrames);
+	ICustomView* transferCurveView[6] = { nullptr, nullptr, nullptr, nullptr, nullptr, nullptr };
+	ICustomView* crossoverResponseView = nullptr;
+	uint32_t responseViewCount = 0;					///< samples since the response views were last sent data
 
 	// --- END USER VARIABLES AND FUNCTIONS -------------------------------------- //
 
@@ -112,13 +112,107 @@ namespace VSTGUI
 
 const bool ENABLE_CUSTOM_VIEWS = true;
 
+/**
+\brief get the cache map; function-local static so it is constructed on first use
+*/
+std::map<uint64_t, UIDescription*>& UIDescriptionCache::getCache()
+{
+	static std::map<uint64_t, UIDescription*> cache;
+	return cache;
+}
+
+/**
+\brief get the cache lock; editors may be opened from different host threads
+*/
+std::mutex& UIDescriptionCache::getMutex()
+{
+	static std::mutex cacheMutex;
+	return cacheMutex;
+}
+
+/**
+\brief 64-bit FNV-1a hash of a block of data
+
+\param data pointer to the data
+\param length number of bytes
+
+\return the hash value
+*/
+uint64_t UIDescriptionCache::hashContent(const char* data, size_t length)
+{
+	uint64_t hash = 14695981039346656037ULL;
+	for (size_t i = 0; i < length; i++)
+	{
+		hash ^= (uint8_t)data[i];
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+/**
+\brief find or create the parsed description for an XML file
+
+Operation: \n
+- hash the file contents (or the name if the file is not readable, e.g. a resource)
+- return the cached description if there is one
+- otherwise parse the XML once and cache the result
+
+\param xmlFile the XML file path or resource name
+
+\return the description with one reference owned by the caller, or nullptr on a parse failure
+*/
+UIDescription* UIDescriptionCache::getDescription(UTF8StringPtr xmlFile)
+{
+	if (!xmlFile)
+		return nullptr;
+
+	// --- key on the content so an edited file is never served stale
+	std::string content;
+	FILE* file = fopen(xmlFile, "rb");
+	if (file)
+	{
+		char buffer[65536];
+		size_t count = 0;
+		while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0)
+			content.append(buffer, count);
+		fclose(file);
+	}
+	else
+		content = xmlFile;
+
+	uint64_t key = hashContent(content.data(), content.size());
+
+	std::lock_guard<std::mutex> lock(getMutex());
+	std::map<uint64_t, UIDescription*>& cache = getCache();
+
+	std::map<uint64_t, UIDescription*>::iterator it = cache.find(key);
+	if (it != cache.end())
+	{
+		it->second->remember();
+		return it->second;
+	}
+
+	// --- first open with this content: parse it
+	UIDescription* description = new UIDescription(xmlFile);
+	if (!description->parse())
+	{
+		description->forget();
+		return nullptr;
+	}
+
+	// --- the cache keeps one reference; the caller gets another
+	cache[key] = description;
+	description->remember();
+	return description;
+}
+
 /**
 \brief PluginGUI constructor; note that this maintains both Mac and Windows contexts, the bundle ref for Mac
 and the external void* for Windows.
 
 Operation: \n
-- creates UIDescription from the XML file; stores both the file and the description object (they get used or written later)
-- calls description->parse() to convert XML into objects
+- gets the UIDescription for the XML file from the UIDescriptionCache; stores both the file and the description object (they get used or written later)
+- the XML is only parsed (description->parse()) the first time a given file content is opened in this process
 - initializes main attributes
 - sets up the GUI timer for a 50 millisecond repaint interval
 */
@@ -143,14 +237,9 @@ PluginGUI::PluginGUI(UTF8StringPtr _xmlFile) :
     m_AU = nullptr;
 #endif
 
-	// --- create description from XML file
+	// --- get the (shared) description for the XML file; parses it on first use only
 	xmlFile = _xmlFile;
-	description = new UIDescription(_xmlFile);
-	if (!description->parse())
-	{
-		description->forget();
-		description = nullptr;
-	}
+	description = UIDescriptionCache::getDescription(_xmlFile);
 
     // --- set attributes
     guiPluginConnector = nullptr;
@@ -624,12 +713,40 @@ void PluginGUI::writeToPresetFile()
 	}
 }
 
+/**
+\brief split the writeable controls into meters and other controls and rebuild the
+       batch ballistics; called from idle( ) after the writeable controls have changed
+*/
+void PluginGUI::updateMeterBallistics()
+{
+	meterBallistics.clear();
+	meters.clear();
+	otherWriteableControls.clear();
+
+	for (std::vector<CControl*>::iterator it = writeableControls.begin(); it != writeableControls.end(); ++it)
+	{
+		CVuMeterEx* meter = dynamic_cast<CVuMeterEx*>(*it);
+		if (meter)
+		{
+			meter->addToBallistics(meterBallistics);
+			meters.push_back(meter);
+		}
+		else
+			otherWriteableControls.push_back(*it);
+	}
+
+	meterInputs.assign(meters.size(), 0.f);
+	meterLevels.assign(meters.size(), 0.f);
+	meterBallisticsDirty = false;
+}
+
 /**
 \brief perform idling operation; called directly from timer thread
 
 Operation:\n
 - send the timer ping message
 - send process loop output data to any output-only receivers (meters)
+- run the meter ballistics for all meters in one batch
 - issue the repaint message to the outer frame
 */
 void PluginGUI::idle()
@@ -640,7 +757,23 @@ void PluginGUI::idle()
         if(guiPluginConnector)
             guiPluginConnector->guiTimerPing();
 
-        for(std::vector<CControl*>::iterator it = writeableControls.begin(); it != writeableControls.end(); ++it)
+        if(meterBallisticsDirty)
+            updateMeterBallistics();
+
+        // --- meters: gather the raw values, run the ballistics for all of them at once
+        //     and let each meter invalidate only the LEDs that changed
+        if(guiPluginConnector && meters.size() > 0)
+        {
+            for(uint32_t i = 0; i < meters.size(); i++)
+                meterInputs[i] = (float)guiPluginConnector->getNormalizedPluginParameter(meters[i]->getTag());
+
+            meterBallistics.process(&meterInputs[0], &meterLevels[0]);
+
+            for(uint32_t i = 0; i < meters.size(); i++)
+                meters[i]->setMeterLevel(meterLevels[i]);
+        }
+
+        for(std::vector<CControl*>::iterator it = otherWriteableControls.begin(); it != otherWriteableControls.end(); ++it)
         {
             CControl* ctrl = *it;
             if(ctrl)
@@ -863,7 +996,7 @@ Operation:\n
 - create the GUI Designer if the boolean flag is set
 - otherwise create the normal GUI
 - note that this is all handled with the description that we cahched in the constructor
-- for the GUI designer, we create a new UIEditController 
+- for the GUI designer, we switch to a private copy of the description and create a new UIEditController 
 - for the normal GUI, we create a new View
 
 \param bShowGUIEditor create the drag-and-drop GUI designer
@@ -883,6 +1016,22 @@ bool PluginGUI::createGUI(bool bShowGUIEditor)
 		{
 			guiEditorFrame->setTransform(CGraphicsTransform());
 			nonEditRect = guiEditorFrame->getViewSize();
+
+			// --- the designer stores its controller in the description and edits it, so it must not
+			//     touch the shared (cached) one: switch this editor to a private parse of the file
+			if (!privateDescription)
+			{
+				UIDescription* editDescription = new UIDescription(xmlFile.c_str());
+				if (!editDescription->parse())
+				{
+					editDescription->forget();
+					return false;
+				}
+				if (description)
+					description->forget();
+				description = editDescription;
+				privateDescription = true;
+			}
 			description->setController((IController*)this);
 
 			// --- persistent
@@ -1084,7 +1233,8 @@ void PluginGUI::save(bool saveAs)
 	if (savePath.empty())
 		return;
 
-	// --- save file
+	// --- save file; the designer edits a private description, and the cache is keyed on the content,
+	//     so the next editor to open parses the new file
 	description->save(savePath.c_str(), flags);
 }
 
@@ -1799,6 +1949,33 @@ CView* PluginGUI::createUserCustomView(std::string viewname, const CRect rect, I
 #endif
 	}
 
+	// --- gain reduction history for all six processors
+	if (viewname.compare("GainReductionView") == 0)
+	{
+		return new GainReductionView(rect, listener, tag);
+	}
+
+	// --- transfer curves: TransferCurveView1 ... TransferCurveView6
+	if (viewname.compare(0, 17, "TransferCurveView") == 0)
+	{
+		return new TransferCurveView(rect, listener, tag);
+	}
+
+	if (viewname.compare("CrossoverResponseView") == 0)
+	{
+		return new CrossoverResponseView(rect, listener, tag);
+	}
+
+	// --- per-band analyzers: BandSpectrumView1 ... BandSpectrumView4
+	if (viewname.compare(0, 16, "BandSpectrumView") == 0)
+	{
+#ifdef HAVE_FFTW
+		return new BandSpectrumView(rect, listener, tag);
+#else
+		return new WaveView(rect, listener, tag);
+#endif
+	}
+
 	return nullptr;
 }
 
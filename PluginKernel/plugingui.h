@@ -58,6 +58,7 @@
 #include <algorithm>
 #include <functional>
 #include <cctype>
+#include <mutex>
 #include <locale>
 #include <map>
 
@@ -382,6 +383,42 @@ protected:
 };
 
 
+/**
+\class UIDescriptionCache
+\ingroup ASPiK-GUI
+\brief
+Process-wide cache of parsed UIDescription objects, keyed by a hash of the XML content.
+
+- every PluginGUI instance that opens with the same .uidesc content shares one parsed description,
+  so the (large) XML file is parsed once per process instead of once per editor open
+- the key is the FNV-1a hash of the file contents; if the file can not be read directly (e.g. it is a
+  platform resource) the file name is hashed instead
+- descriptions are held for the lifetime of the process; they are intentionally not released at static
+  destruction time since the platform bitmaps they own may outlive the graphics subsystem
+- shared descriptions are read-only and controller-free: the GUI designer sets itself as the description's
+  controller and edits it, so an editor entering designer mode switches to a private parse of the file
+  (see PluginGUI::createGUI( )); saving changes the file content, so the next open parses the new file
+
+\author Christian George
+\version Revision : 1.0
+*/
+class UIDescriptionCache
+{
+public:
+	/** get a parsed description for the XML file; the caller owns one reference and must forget() it
+	\param xmlFile the XML file path or resource name
+	\return the parsed description or nullptr if the XML could not be parsed
+	*/
+	static UIDescription* getDescription(UTF8StringPtr xmlFile);
+
+	/** 64-bit FNV-1a hash used as the cache key */
+	static uint64_t hashContent(const char* data, size_t length);
+
+private:
+	static std::map<uint64_t, UIDescription*>& getCache();
+	static std::mutex& getMutex();
+};
+
 /**
 \class PluginGUI
 \ingroup ASPiK-GUI
@@ -492,6 +529,7 @@ protected:
 	// --- protected variables
     IGUIPluginConnector* guiPluginConnector = nullptr; ///< the plugin shell interface that arrives with the open( ) function; OK if NULL for standalone GUIs
 	UIDescription* description = nullptr; ///< the description version of the XML file
+	bool privateDescription = false;	///< description is this editor's own parse (GUI designer), not the shared one
 	std::string viewName;			///< name
 	std::string xmlFile;			///< the XML file name
 
@@ -750,6 +788,7 @@ public:
         {
             writeableControls.push_back(control);
             control->remember();
+            meterBallisticsDirty = true;
         }
     }
 
@@ -769,6 +808,7 @@ public:
             {
                 ctrl->forget();
 				writeableControls.erase(it);
+				meterBallisticsDirty = true;
 				return;
             }
         }
@@ -798,6 +838,7 @@ public:
 			ctrl->forget();
 		}
         writeableControls.clear();
+		meterBallisticsDirty = true;
 	}
 
 	/**
@@ -834,6 +875,15 @@ private:
     typedef std::map<int32_t, ControlUpdateReceiver*> ControlUpdateReceiverMap; ///< map of control receivers
     ControlUpdateReceiverMap controlUpdateReceivers;
     std::vector<CControl*> writeableControls;		///< vector of meters
+
+	// --- batch meter ballistics; rebuilt from writeableControls in idle( ) when dirty
+	void updateMeterBallistics();
+	CMeterBallistics meterBallistics;				///< ballistics for all meters, run once per idle( )
+	std::vector<CVuMeterEx*> meters;				///< meters in ballistics slot order (not remembered; owned by writeableControls)
+	std::vector<CControl*> otherWriteableControls;	///< non-meter writeable controls
+	std::vector<float> meterInputs;					///< raw meter values, one per slot
+	std::vector<float> meterLevels;					///< detected meter values, one per slot
+	bool meterBallisticsDirty = true;				///< rebuild flag
     std::vector<PluginParameter*> pluginParameters; ///< local COPY of parameters
 
 #ifdef AAXPLUGIN
@@ -1377,6 +1377,97 @@ struct JSControl
 };
 
 
+// --- samples per analyzer block; at 48kHz this is ~5mSec of audio per message
+const uint32_t ANALYZER_BLOCK_LEN = 256;
+
+/**
+\struct AnalyzerDataBlock
+\ingroup Structures
+\brief
+Block of pre- and post-processing samples sent from the audio thread to a spectrum analyzer view
+with ICustomView::sendMessage( ). The view copies the block into its own lock-free queue so the
+audio thread never waits on, or allocates for, the GUI.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 18
+*/
+struct AnalyzerDataBlock
+{
+	uint32_t count = 0;						///< valid samples in pre[] and post[]
+	double sampleRate = 44100.0;			///< sample rate of the block data (after decimation)
+	double splitF[3] = { 0.0, 0.0, 0.0 };	///< crossover frequencies, for the view's markers
+	float pre[ANALYZER_BLOCK_LEN] = { 0.f };	///< pre-processing (input) samples
+	float post[ANALYZER_BLOCK_LEN] = { 0.f };	///< post-processing (output) samples
+};
+
+
+// --- one gain reduction history column per interval; with a 400 pixel view this is 4 seconds
+const double GR_HISTORY_INTERVAL_MSEC = 10.0;
+const uint32_t GR_HISTORY_TRACES = 6;
+
+/**
+\struct GainReductionDataBlock
+\ingroup Structures
+\brief
+Minimum and maximum gain (linear, 1.0 = no reduction) of each dynamics processor over one
+GR_HISTORY_INTERVAL_MSEC interval. Sent from the audio thread to the gain reduction history view
+with ICustomView::sendMessage( ); the view copies it into its own lock-free queue.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 18
+*/
+struct GainReductionDataBlock
+{
+	float gainMin[GR_HISTORY_TRACES] = { 1.f, 1.f, 1.f, 1.f, 1.f, 1.f }; ///< most reduction over the interval
+	float gainMax[GR_HISTORY_TRACES] = { 1.f, 1.f, 1.f, 1.f, 1.f, 1.f }; ///< least reduction over the interval
+};
+
+
+// --- how often the audio thread sends curve and crossover data to the response views
+const double RESPONSE_VIEW_INTERVAL_MSEC = 20.0;
+
+/**
+\struct DynamicsCurveData
+\ingroup Structures
+\brief
+Static curve settings and current detector level of one dynamics processor, sent from the audio
+thread to a transfer curve view with ICustomView::sendMessage( ).
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 18
+*/
+struct DynamicsCurveData
+{
+	double threshold_dB = -10.0;	///< threshold in dB
+	double ratio = 1.0;				///< I/O gain ratio
+	double kneeWidth_dB = 0.0;		///< knee width in dB
+	double outputGain_dB = 0.0;		///< make up gain
+	bool softKnee = true;			///< soft knee flag
+	bool hardLimitGate = false;		///< limiter (compressor) or gate (expander)
+	bool expander = false;			///< downward expander, else compressor
+	double detect_dB = -96.0;		///< current detector level, for the live dot
+};
+
+/**
+\struct CrossoverResponseData
+\ingroup Structures
+\brief
+Crossover settings sent from the audio thread to the crossover response view with ICustomView::sendMessage( ).
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 18
+*/
+struct CrossoverResponseData
+{
+	double sampleRate = 44100.0;			///< current sample rate
+	double splitF[3] = { 0.0, 0.0, 0.0 };	///< crossover frequencies
+};
+
+
 // --------------------------------------------------------------------------------------------------------------------------- //
 // --- INTERFACES
 // --------------------------------------------------------------------------------------------------------------------------- //
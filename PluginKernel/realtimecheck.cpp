@@ -0,0 +1,274 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Plugin Kernel File:  realtimecheck.cpp
+//
+/**
+    \file   realtimecheck.cpp
+    \author Christian George
+    \date   19-October-2026
+    \brief  real-time safety checker: allocator, pthread and system call interposers (Linux, ASPIK_REALTIME_CHECK)
+*/
+// -----------------------------------------------------------------------------
+// --- the wrappers redefine libc functions, so the fortified inline versions must not be declared
+#ifdef ASPIK_REALTIME_CHECK
+#undef _FORTIFY_SOURCE
+#endif
+
+#include "realtimecheck.h"
+
+#ifdef ASPIK_REALTIME_CHECK_ENABLED
+
+#include <atomic>
+#include <dlfcn.h>
+#include <errno.h>
+#include <execinfo.h>
+#include <fcntl.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+// --- glibc's allocator entry points; the allocator wrappers forward here, so they never need dlsym( )
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_calloc(size_t count, size_t size);
+extern "C" void* __libc_realloc(void* pointer, size_t size);
+extern "C" void __libc_free(void* pointer);
+extern "C" void* __libc_memalign(size_t alignment, size_t size);
+
+namespace
+{
+	// --- per thread: audio callback nesting depth, and a flag that lets the checker's own calls through;
+	//     initial-exec so reading them never allocates
+	__thread int callbackDepth __attribute__((tls_model("initial-exec"))) = 0;
+	__thread int inChecker __attribute__((tls_model("initial-exec"))) = 0;
+
+	std::atomic<uint64_t> violationCount{ 0 };		///< violations so far
+	std::atomic<uint32_t> maxReports{ UINT32_MAX };	///< reports to print
+	std::atomic<bool> abortOnViolation{ false };	///< abort( ) on a violation
+
+	/** read the environment switches before main( ) */
+	__attribute__((constructor)) void readEnvironment()
+	{
+		const char* abortSetting = getenv("ASPIK_RT_CHECK_ABORT");
+		if (abortSetting && abortSetting[0] == '1')
+			abortOnViolation = true;
+
+		const char* maxSetting = getenv("ASPIK_RT_CHECK_MAX_REPORTS");
+		if (maxSetting)
+			maxReports = (uint32_t)strtoul(maxSetting, nullptr, 10);
+	}
+
+	/** print to stderr with the raw system call, past the write( ) wrapper */
+	void printError(const char* text)
+	{
+		syscall(SYS_write, 2, text, strlen(text));
+	}
+
+	/** count and report the call if this thread is in the audio callback */
+	void checkCall(const char* function)
+	{
+		if (callbackDepth == 0 || inChecker)
+			return;
+
+		inChecker = 1;
+		const uint64_t count = violationCount.fetch_add(1) + 1;
+		if (count <= maxReports.load())
+		{
+			char header[160];
+			snprintf(header, sizeof(header), "[realtime check] violation %llu: %s( ) called in the audio callback\n",
+					 (unsigned long long)count, function);
+			printError(header);
+
+			// --- backtrace( ) may allocate the first time (it loads the unwinder); inChecker lets that through
+			void* frames[64];
+			const int depth = backtrace(frames, 64);
+			backtrace_symbols_fd(frames, depth, 2);
+		}
+
+		if (abortOnViolation.load())
+			abort();
+		inChecker = 0;
+	}
+
+	/** look up the next definition of a symbol once; dlsym( ) may allocate, so the checker is bypassed */
+	template <typename Function>
+	Function nextFunction(Function& cache, const char* name)
+	{
+		if (!cache)
+		{
+			const int saved = inChecker;
+			inChecker = 1;
+			cache = (Function)dlsym(RTLD_NEXT, name);
+			inChecker = saved;
+		}
+		return cache;
+	}
+}
+
+// --- RealtimeCheck
+void RealtimeCheck::enterAudioCallback() { callbackDepth++; }
+void RealtimeCheck::exitAudioCallback() { if (callbackDepth > 0) callbackDepth--; }
+bool RealtimeCheck::isInAudioCallback() { return callbackDepth > 0; }
+uint64_t RealtimeCheck::getViolationCount() { return violationCount.load(); }
+void RealtimeCheck::resetViolationCount() { violationCount = 0; }
+void RealtimeCheck::setAbortOnViolation(bool b) { abortOnViolation = b; }
+void RealtimeCheck::setMaxReports(uint32_t _maxReports) { maxReports = _maxReports; }
+
+extern "C"
+{
+	// --- allocator (operator new and delete end up here too)
+	void* malloc(size_t size) __THROW
+	{
+		checkCall("malloc");
+		return __libc_malloc(size);
+	}
+
+	void* calloc(size_t count, size_t size) __THROW
+	{
+		checkCall("calloc");
+		return __libc_calloc(count, size);
+	}
+
+	void* realloc(void* pointer, size_t size) __THROW
+	{
+		checkCall("realloc");
+		return __libc_realloc(pointer, size);
+	}
+
+	void free(void* pointer) __THROW
+	{
+		if (pointer)
+			checkCall("free");
+		__libc_free(pointer);
+	}
+
+	void* memalign(size_t alignment, size_t size) __THROW
+	{
+		checkCall("memalign");
+		return __libc_memalign(alignment, size);
+	}
+
+	void* aligned_alloc(size_t alignment, size_t size) __THROW
+	{
+		checkCall("aligned_alloc");
+		return __libc_memalign(alignment, size);
+	}
+
+	int posix_memalign(void** pointer, size_t alignment, size_t size) __THROW
+	{
+		checkCall("posix_memalign");
+		if (alignment < sizeof(void*) || (alignment & (alignment - 1)) != 0)
+			return EINVAL;
+
+		void* memory = __libc_memalign(alignment, size);
+		if (!memory)
+			return ENOMEM;
+
+		*pointer = memory;
+		return 0;
+	}
+
+	// --- blocking synchronization
+	int pthread_mutex_lock(pthread_mutex_t* mutex) __THROWNL
+	{
+		static int (*next)(pthread_mutex_t*) = nullptr;
+		checkCall("pthread_mutex_lock");
+		return nextFunction(next, "pthread_mutex_lock")(mutex);
+	}
+
+	int pthread_rwlock_rdlock(pthread_rwlock_t* lock) __THROWNL
+	{
+		static int (*next)(pthread_rwlock_t*) = nullptr;
+		checkCall("pthread_rwlock_rdlock");
+		return nextFunction(next, "pthread_rwlock_rdlock")(lock);
+	}
+
+	int pthread_rwlock_wrlock(pthread_rwlock_t* lock) __THROWNL
+	{
+		static int (*next)(pthread_rwlock_t*) = nullptr;
+		checkCall("pthread_rwlock_wrlock");
+		return nextFunction(next, "pthread_rwlock_wrlock")(lock);
+	}
+
+	int sem_wait(sem_t* semaphore)
+	{
+		static int (*next)(sem_t*) = nullptr;
+		checkCall("sem_wait");
+		return nextFunction(next, "sem_wait")(semaphore);
+	}
+
+	// --- system calls
+	int open(const char* path, int flags, ...)
+	{
+		static int (*next)(const char*, int, ...) = nullptr;
+
+		// --- the mode argument is only passed when the file may be created
+		mode_t mode = 0;
+		if (flags & (O_CREAT | O_TMPFILE))
+		{
+			va_list args;
+			va_start(args, flags);
+			mode = (mode_t)va_arg(args, int);
+			va_end(args);
+		}
+
+		checkCall("open");
+		return nextFunction(next, "open")(path, flags, mode);
+	}
+
+	ssize_t read(int fd, void* buffer, size_t count)
+	{
+		static ssize_t (*next)(int, void*, size_t) = nullptr;
+		checkCall("read");
+		return nextFunction(next, "read")(fd, buffer, count);
+	}
+
+	ssize_t write(int fd, const void* buffer, size_t count)
+	{
+		static ssize_t (*next)(int, const void*, size_t) = nullptr;
+		checkCall("write");
+		return nextFunction(next, "write")(fd, buffer, count);
+	}
+
+	int close(int fd)
+	{
+		static int (*next)(int) = nullptr;
+		checkCall("close");
+		return nextFunction(next, "close")(fd);
+	}
+
+	int nanosleep(const struct timespec* duration, struct timespec* remaining)
+	{
+		static int (*next)(const struct timespec*, struct timespec*) = nullptr;
+		checkCall("nanosleep");
+		return nextFunction(next, "nanosleep")(duration, remaining);
+	}
+
+	int usleep(useconds_t microseconds)
+	{
+		static int (*next)(useconds_t) = nullptr;
+		checkCall("usleep");
+		return nextFunction(next, "usleep")(microseconds);
+	}
+
+	FILE* fopen(const char* path, const char* mode)
+	{
+		static FILE* (*next)(const char*, const char*) = nullptr;
+		checkCall("fopen");
+		return nextFunction(next, "fopen")(path, mode);
+	}
+
+	int fflush(FILE* stream)
+	{
+		static int (*next)(FILE*) = nullptr;
+		checkCall("fflush");
+		return nextFunction(next, "fflush")(stream);
+	}
+}
+
+#endif // ASPIK_REALTIME_CHECK_ENABLED
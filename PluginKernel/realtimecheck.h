@@ -0,0 +1,106 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Plugin Kernel File:  realtimecheck.h
+//
+/**
+    \file   realtimecheck.h
+    \author Christian George
+    \date   19-October-2026
+    \brief  real-time safety checker for the audio thread (debug and test builds)
+*/
+// -----------------------------------------------------------------------------
+#ifndef __RealtimeCheck__
+#define __RealtimeCheck__
+
+#include <stdint.h>
+
+// --- the checker is only built with ASPIK_REALTIME_CHECK defined, and only on Linux; otherwise
+//     everything here is an empty inline function and costs nothing
+#if defined(ASPIK_REALTIME_CHECK) && defined(__linux__)
+#define ASPIK_REALTIME_CHECK_ENABLED
+#endif
+
+/**
+\class RealtimeCheck
+\ingroup ASPiK-Core
+\brief
+Flags calls that are not real-time safe when they are made from inside the audio callback.
+
+- realtimecheck.cpp interposes the allocator (malloc, calloc, realloc, free and the aligned variants, so
+  operator new and delete too), the blocking pthread calls (mutex and rwlock locks, sem_wait) and the common
+  system call wrappers (open, read, write, close, nanosleep, usleep, fopen, fflush)
+- each wrapper checks a thread-local "in audio callback" depth; on the audio thread it counts a violation and
+  prints the call and a stack trace to stderr, then forwards to the real function
+- PluginBase::processAudioBuffers( ) marks the callback with a ScopedRealtimeCheck, so parameter updates,
+  pre/post processing and every processAudioFrame( ) call are covered
+- the interposition needs the wrappers to win symbol lookup: link realtimecheck.cpp into the executable
+  (offline renderer, test runner) or into a library loaded with LD_PRELOAD; inside a dlopen'ed plugin it only
+  sees calls the plugin makes through its own PLT
+- environment: ASPIK_RT_CHECK_ABORT=1 aborts on the first violation (for tests), ASPIK_RT_CHECK_MAX_REPORTS=n
+  stops printing after n reports (violations are still counted)
+
+Build:
+- define ASPIK_REALTIME_CHECK and link with -ldl (and -rdynamic for readable stack traces)
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+class RealtimeCheck
+{
+public:
+#ifdef ASPIK_REALTIME_CHECK_ENABLED
+	/** mark the calling thread as inside the audio callback (nests) */
+	static void enterAudioCallback();
+
+	/** mark the calling thread as leaving the audio callback */
+	static void exitAudioCallback();
+
+	/** true if the calling thread is inside the audio callback */
+	static bool isInAudioCallback();
+
+	/** get the number of violations since the start (or the last resetViolationCount( )) */
+	static uint64_t getViolationCount();
+
+	/** clear the violation count */
+	static void resetViolationCount();
+
+	/** abort( ) on the next violation; for test runs */
+	static void setAbortOnViolation(bool b);
+
+	/** print at most this many reports; later violations are only counted */
+	static void setMaxReports(uint32_t maxReports);
+#else
+	static void enterAudioCallback() {}
+	static void exitAudioCallback() {}
+	static bool isInAudioCallback() { return false; }
+	static uint64_t getViolationCount() { return 0; }
+	static void resetViolationCount() {}
+	static void setAbortOnViolation(bool) {}
+	static void setMaxReports(uint32_t) {}
+#endif
+};
+
+/**
+\class ScopedRealtimeCheck
+\ingroup ASPiK-Core
+\brief
+Marks the calling thread as inside the audio callback for the lifetime of the object (see RealtimeCheck).
+
+PluginBase::processAudioBuffers( ) creates one on the stack; if you override processAudioBuffers( ) in your
+PluginCore, declare one at the top of your version, next to the ScopedDenormalGuard.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+class ScopedRealtimeCheck
+{
+public:
+	ScopedRealtimeCheck() { RealtimeCheck::enterAudioCallback(); }
+	~ScopedRealtimeCheck() { RealtimeCheck::exitAudioCallback(); }
+
+	ScopedRealtimeCheck(const ScopedRealtimeCheck&) = delete;
+	ScopedRealtimeCheck& operator=(const ScopedRealtimeCheck&) = delete;
+};
+
+#endif
@@ -24,6 +24,7 @@ enum class msSelection {kSummed, kMid, kSide};
 struct FourBandDynamicsParameters
 {
 	FourBandDynamicsParameters() {}
+	FourBandDynamicsParameters(const FourBandDynamicsParameters& params) = default;
 
 	/** all FXObjects parameter objects require overloaded= operator so remember to add new entries if you add new variables. */
 	FourBandDynamicsParameters& operator=(const FourBandDynamicsParameters& params)	// need this override for collections to work
@@ -67,6 +68,12 @@ struct FourBandDynamicsParameters
 			scTarget[i] = params.scTarget[i];
 
 		}
+
+		for (int i = 0; i < 4; i++)
+		{
+			analyzerPre[i] = params.analyzerPre[i];
+			analyzerPost[i] = params.analyzerPost[i];
+		}
 		
 
 		enableMS = params.enableMS;
@@ -81,7 +88,7 @@ struct FourBandDynamicsParameters
 	}
 
 	// --- split frequencies
-	double splitF[3];
+	double splitF[3] = { 200.0, 1000.0, 10000.0 };
 
 	double threshold[6];
 	double ratio[6];
@@ -108,6 +115,11 @@ struct FourBandDynamicsParameters
 	float masterInputMeter = 0.f;
 	float masterOutputMeter = 0.f;
 
+	// --- band signals (L/R average) for the spectrum analyzers; pre is taken
+	//     before the band's dynamics processor, post after its saturator
+	float analyzerPre[4] = { 0.f, 0.f, 0.f, 0.f };
+	float analyzerPost[4] = { 0.f, 0.f, 0.f, 0.f };
+
 	// MS Compression
 	bool enableMS;
 	msSelection msView = msSelection::kSummed;
@@ -122,6 +134,265 @@ struct FourBandDynamicsParameters
 	
 };
 
+/**
+@morphParameters
+\ingroup FX-Functions
+
+@brief Morph between two FourBandDynamicsParameters snapshots. Continuous controls are interpolated
+(split frequencies on a log scale so the crossovers sweep evenly), switches flip at the halfway point.
+Meter (outbound) values are taken from the A snapshot.
+
+\param paramsA - snapshot at morph = 0.0
+\param paramsB - snapshot at morph = 1.0
+\param morph - morph position from 0.0 to 1.0
+\return the morphed parameter set
+*/
+inline FourBandDynamicsParameters morphParameters(const FourBandDynamicsParameters& paramsA,
+												  const FourBandDynamicsParameters& paramsB, double morph)
+{
+	FourBandDynamicsParameters params = paramsA;
+	boundValue(morph, 0.0, 1.0);
+
+	// --- switches change over at the halfway point
+	const FourBandDynamicsParameters& switches = morph < 0.5 ? paramsA : paramsB;
+
+	for (int i = 0; i < 3; i++)
+		params.splitF[i] = paramsA.splitF[i] * pow(paramsB.splitF[i] / paramsA.splitF[i], morph);
+
+	for (int i = 0; i < 6; i++)
+	{
+		params.threshold[i] = doLinearInterpolation(paramsA.threshold[i], paramsB.threshold[i], morph);
+		params.ratio[i] = doLinearInterpolation(paramsA.ratio[i], paramsB.ratio[i], morph);
+		params.attack[i] = doLinearInterpolation(paramsA.attack[i], paramsB.attack[i], morph);
+		params.release[i] = doLinearInterpolation(paramsA.release[i], paramsB.release[i], morph);
+		params.gain[i] = doLinearInterpolation(paramsA.gain[i], paramsB.gain[i], morph);
+		params.knee[i] = doLinearInterpolation(paramsA.knee[i], paramsB.knee[i], morph);
+		params.saturation[i] = doLinearInterpolation(paramsA.saturation[i], paramsB.saturation[i], morph);
+
+		params.hardLimitGate[i] = switches.hardLimitGate[i];
+		params.dynamicsMode[i] = switches.dynamicsMode[i];
+		params.bypass[i] = switches.bypass[i];
+		params.enableMute[i] = switches.enableMute[i];
+		params.enableSolo[i] = switches.enableSolo[i];
+	}
+
+	for (int i = 0; i < 4; i++)
+		params.scTarget[i] = switches.scTarget[i];
+
+	params.dryVolume = doLinearInterpolation(paramsA.dryVolume, paramsB.dryVolume, morph);
+	params.masterOutputVolume = doLinearInterpolation(paramsA.masterOutputVolume, paramsB.masterOutputVolume, morph);
+
+	params.enableMS = switches.enableMS;
+	params.msView = switches.msView;
+	params.enableSidechain = switches.enableSidechain;
+	params.scTargetAll = switches.scTargetAll;
+
+	return params;
+}
+
+// --- parameter changes and morphs are cooked once per CONTROL_RATE_INTERVAL samples
+const unsigned int CONTROL_RATE_INTERVAL = 32;
+
+// --- per-stage profiling: define FOURBAND_DYNAMICS_PROFILING to build it in; without it the
+//     FOURBAND_PROFILE_* macros expand to nothing and the profile accessors are empty stubs
+#ifdef FOURBAND_DYNAMICS_PROFILING
+#include <atomic>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define FOURBAND_PROFILE_TSC
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define FOURBAND_PROFILE_TSC
+#else
+#include <chrono>
+#endif
+#endif
+
+/** FourBandDynamics hot-path stages, in processing order */
+enum class dynamicsStage
+{
+	kControlRate,	///< control rate parameter cooking and morphing
+	kCrossover,		///< the three TPT splitter pairs and the dry sum
+	kDetection,		///< per-band (and M/S) envelope detectors
+	kGainComputer,	///< gain computers, makeup gain and DCAs
+	kSaturation,	///< tanh saturation
+	kMuteSolo,		///< mute/solo logic
+	kMidSide,		///< M/S encode and decode
+	kSumming,		///< band summing, dry mix and master volume
+	kMetering,		///< input, output and gain reduction meters
+	kNumStages
+};
+
+// --- log2 histogram: bin n counts blocks that took [2^n, 2^(n+1)) ticks in a stage
+const unsigned int DYNAMICS_PROFILE_BINS = 32;
+
+/**
+\struct DynamicsStageProfile
+\ingroup FX-Objects
+\brief
+A snapshot of one stage's block timings, copied out of a FourBandDynamics profile by getStageProfile( ).
+
+Ticks are TSC cycles on x86 and nanoseconds elsewhere; see FourBandDynamics::getProfileTickUnit( ).
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+struct DynamicsStageProfile
+{
+	uint64_t blocks = 0;		///< blocks measured
+	uint64_t totalTicks = 0;	///< sum over all blocks
+	uint64_t maxTicks = 0;		///< slowest block
+	uint64_t lastTicks = 0;		///< most recent block
+	uint32_t histogram[DYNAMICS_PROFILE_BINS] = { 0 };	///< log2 histogram of ticks per block
+
+	/** mean ticks per block */
+	double getMeanTicks() const { return blocks > 0 ? (double)totalTicks / (double)blocks : 0.0; }
+};
+
+#ifdef FOURBAND_DYNAMICS_PROFILING
+/**
+\class DynamicsProfiler
+\ingroup FX-Objects
+\brief
+Per-instance stage timer for FourBandDynamics (FOURBAND_DYNAMICS_PROFILING builds only).
+
+- the audio thread calls beginFrame( ) and then mark( ) at the end of each stage; each mark adds the ticks since
+  the previous mark to that stage's total for the current block
+- endBlock( ) moves the block totals into the per-stage histograms
+- the histograms are atomics with a single writer (the audio thread), so getStageProfile( ) and reset( ) can be
+  called from the GUI thread or an offline renderer without locks; a snapshot may mix two adjacent blocks
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+class DynamicsProfiler
+{
+public:
+	DynamicsProfiler()
+	{
+		for (unsigned int i = 0; i < kStages; i++)
+		{
+			blockTicks[i] = 0;
+			stage[i].blocks = 0;
+			stage[i].totalTicks = 0;
+			stage[i].maxTicks = 0;
+			stage[i].lastTicks = 0;
+			for (unsigned int j = 0; j < DYNAMICS_PROFILE_BINS; j++)
+				stage[i].histogram[j] = 0;
+		}
+	}
+
+	/** read the tick counter */
+	static inline uint64_t readTicks()
+	{
+#ifdef FOURBAND_PROFILE_TSC
+		return __rdtsc();
+#else
+		return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+	}
+
+	/** unit of the tick counter */
+	static const char* getTickUnit()
+	{
+#ifdef FOURBAND_PROFILE_TSC
+		return "cycles";
+#else
+		return "ns";
+#endif
+	}
+
+	/** start timing a frame */
+	inline void beginFrame() { lastTicks = readTicks(); }
+
+	/** charge the ticks since the last mark to a stage */
+	inline void mark(dynamicsStage _stage)
+	{
+		const uint64_t now = readTicks();
+		blockTicks[(unsigned int)_stage] += now - lastTicks;
+		lastTicks = now;
+	}
+
+	/** push this block's stage totals into the histograms (audio thread) */
+	void endBlock()
+	{
+		const bool clear = resetRequested.exchange(false, std::memory_order_acquire);
+
+		for (unsigned int i = 0; i < kStages; i++)
+		{
+			StageHistogram& s = stage[i];
+			const uint64_t ticks = blockTicks[i];
+			blockTicks[i] = 0;
+
+			// --- single writer: plain load/store pairs, no read-modify-write needed
+			if (clear)
+			{
+				s.blocks.store(0, std::memory_order_relaxed);
+				s.totalTicks.store(0, std::memory_order_relaxed);
+				s.maxTicks.store(0, std::memory_order_relaxed);
+				for (unsigned int j = 0; j < DYNAMICS_PROFILE_BINS; j++)
+					s.histogram[j].store(0, std::memory_order_relaxed);
+			}
+
+			unsigned int bin = 0;
+			for (uint64_t t = ticks; t > 1 && bin < DYNAMICS_PROFILE_BINS - 1; t >>= 1)
+				bin++;
+
+			s.histogram[bin].store(s.histogram[bin].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			s.totalTicks.store(s.totalTicks.load(std::memory_order_relaxed) + ticks, std::memory_order_relaxed);
+			if (ticks > s.maxTicks.load(std::memory_order_relaxed))
+				s.maxTicks.store(ticks, std::memory_order_relaxed);
+			s.lastTicks.store(ticks, std::memory_order_relaxed);
+			s.blocks.store(s.blocks.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+		}
+	}
+
+	/** copy one stage's histogram (any thread) */
+	void getStageProfile(dynamicsStage _stage, DynamicsStageProfile& profile) const
+	{
+		const StageHistogram& s = stage[(unsigned int)_stage];
+		profile.blocks = s.blocks.load(std::memory_order_acquire);
+		profile.totalTicks = s.totalTicks.load(std::memory_order_relaxed);
+		profile.maxTicks = s.maxTicks.load(std::memory_order_relaxed);
+		profile.lastTicks = s.lastTicks.load(std::memory_order_relaxed);
+		for (unsigned int j = 0; j < DYNAMICS_PROFILE_BINS; j++)
+			profile.histogram[j] = s.histogram[j].load(std::memory_order_relaxed);
+	}
+
+	/** clear the histograms at the next endBlock( ) (any thread) */
+	void reset() { resetRequested.store(true, std::memory_order_release); }
+
+private:
+	static const unsigned int kStages = (unsigned int)dynamicsStage::kNumStages;
+
+	struct StageHistogram
+	{
+		std::atomic<uint64_t> blocks;
+		std::atomic<uint64_t> totalTicks;
+		std::atomic<uint64_t> maxTicks;
+		std::atomic<uint64_t> lastTicks;
+		std::atomic<uint32_t> histogram[DYNAMICS_PROFILE_BINS];
+	};
+
+	// --- audio thread only
+	uint64_t lastTicks = 0;				///< tick count at the previous mark
+	uint64_t blockTicks[kStages];		///< per-stage totals for the current block
+
+	// --- shared with the readers
+	StageHistogram stage[kStages];
+	std::atomic<bool> resetRequested{ false };
+};
+
+#define FOURBAND_PROFILE_BEGIN() profiler.beginFrame()
+#define FOURBAND_PROFILE_MARK(_stage) profiler.mark(dynamicsStage::_stage)
+#else
+#define FOURBAND_PROFILE_BEGIN()
+#define FOURBAND_PROFILE_MARK(_stage)
+#endif
+
 
 /**
 \class FourBandDynamics
@@ -154,12 +425,22 @@ public:
 		// --- store the sample rate
 		sampleRate = _sampleRate;
 
+		// --- start the splitters at the current split frequencies rather than gliding there
 		for (int i = 0; i < 6; i++)
+		{
+			TPTCrossoverParameters bankParams = splitterFilters[i].getParameters();
+			bankParams.splitFrequency = parameters.splitF[i / 2];
+			splitterFilters[i].setParameters(bankParams);
 			splitterFilters[i].reset(sampleRate);
+		}
 
 		for (int i = 0; i < 6; i++)
 			dynamicsProcessor[i].reset(sampleRate);
 
+		// --- re-cook everything on the next frame
+		controlRateCounter = 0;
+		cookPending = true;
+
 		return true;
 	}
 
@@ -183,6 +464,17 @@ public:
 		uint32_t inputChannels,
 		uint32_t outputChannels)
 	{
+		FOURBAND_PROFILE_BEGIN();
+
+		// --- control rate updates: parameter cooking and morphing
+		if (controlRateCounter == 0)
+			updateControlRate();
+
+		if (++controlRateCounter >= CONTROL_RATE_INTERVAL)
+			controlRateCounter = 0;
+
+		FOURBAND_PROFILE_MARK(kControlRate);
+
 		double xn[2];
 		double yn[2];
 
@@ -206,6 +498,10 @@ public:
 		// --- MS Conversion
 		double msOutput[2];
 
+		// --- per-channel band signals around the compressors, for metering
+		double bandPre[4][2];
+		double bandPost[4][2];
+
 
 		
 		// --- for loop for Stereo Processing
@@ -227,35 +523,58 @@ public:
 				+ midSplit[i].LFOut + midSplit[i].HFOut
 				+ highSplit[i].LFOut + highSplit[i].HFOut);
 
+			FOURBAND_PROFILE_MARK(kCrossover);
+
 			msOutput[0] = 0.5 * (dryInput[0] + dryInput[1]);
 			msOutput[1] = 0.5 * (dryInput[0] - dryInput[1]);
 
-			// --- Input Meter
-			parameters.inputMeter[0] = 0.5 * (lpfOutput[0]+ lpfOutput[1]);
-			parameters.inputMeter[1] = 0.5 * (lowBandOutput[0] + lpfOutput[1]);
-			parameters.inputMeter[2] = 0.5 * (highBandOutput[0] + highBandOutput[1]);
-			parameters.inputMeter[3] = 0.5 * (hpfOutput[0] + hpfOutput[1]);
+			FOURBAND_PROFILE_MARK(kMidSide);
+
+			// --- capture the band before compression; the meters are set after both channels are done
+			bandPre[0][i] = lpfOutput[i];
+			bandPre[1][i] = lowBandOutput[i];
+			bandPre[2][i] = highBandOutput[i];
+			bandPre[3][i] = hpfOutput[i];
+
+			FOURBAND_PROFILE_MARK(kMetering);
 
 			// ** COMPRESSION **
-			lpfOutput[i] = dynamicsProcessor[0].processAudioSample(lpfOutput[i]);
-			lowBandOutput[i] = dynamicsProcessor[1].processAudioSample(lowBandOutput[i]);
-			highBandOutput[i] = dynamicsProcessor[2].processAudioSample(highBandOutput[i]);
-			hpfOutput[i] = dynamicsProcessor[3].processAudioSample(hpfOutput[i]);
+			// --- detectors, then gain computers; split so the two can be timed separately
+			double detect_dB[4];
+			detect_dB[0] = dynamicsProcessor[0].detectLevel(lpfOutput[i]);
+			detect_dB[1] = dynamicsProcessor[1].detectLevel(lowBandOutput[i]);
+			detect_dB[2] = dynamicsProcessor[2].detectLevel(highBandOutput[i]);
+			detect_dB[3] = dynamicsProcessor[3].detectLevel(hpfOutput[i]);
+
+			FOURBAND_PROFILE_MARK(kDetection);
+
+			lpfOutput[i] = dynamicsProcessor[0].applyGain(lpfOutput[i], detect_dB[0]);
+			lowBandOutput[i] = dynamicsProcessor[1].applyGain(lowBandOutput[i], detect_dB[1]);
+			highBandOutput[i] = dynamicsProcessor[2].applyGain(highBandOutput[i], detect_dB[2]);
+			hpfOutput[i] = dynamicsProcessor[3].applyGain(hpfOutput[i], detect_dB[3]);
+
+			FOURBAND_PROFILE_MARK(kGainComputer);
 
 			// --- Saturation
 			if (parameters.saturation[0] > 1)
-				lpfOutput[i] = tanh(lpfOutput[i] * k[0]) / tanh(k[0]);
+				lpfOutput[i] = tanh(lpfOutput[i] * k[0]) / tanhK[0];
 
 			if (parameters.saturation[1] > 1)
-				lowBandOutput[i] = tanh(lowBandOutput[i] * k[1]) / tanh(k[1]);
+				lowBandOutput[i] = tanh(lowBandOutput[i] * k[1]) / tanhK[1];
 
 			if (parameters.saturation[2] > 1)
-				highBandOutput[i] = tanh(highBandOutput[i] * k[2]) / tanh(k[2]);
+				highBandOutput[i] = tanh(highBandOutput[i] * k[2]) / tanhK[2];
 
 			if (parameters.saturation[3] > 1)
-				hpfOutput[i] = tanh(hpfOutput[i] * k[3]) / tanh(k[3]);
+				hpfOutput[i] = tanh(hpfOutput[i] * k[3]) / tanhK[3];
+
+			FOURBAND_PROFILE_MARK(kSaturation);
 
-			
+			// --- capture the band after compression and saturation, ahead of mute/solo
+			bandPost[0][i] = lpfOutput[i];
+			bandPost[1][i] = lowBandOutput[i];
+			bandPost[2][i] = highBandOutput[i];
+			bandPost[3][i] = hpfOutput[i];
 
 
 			// ** MUTE/SOLO **
@@ -286,35 +605,51 @@ public:
 			if (parameters.enableMute[5])
 				msOutput[1] = 0.0;
 
-			
+			FOURBAND_PROFILE_MARK(kMuteSolo);
+
 			// ** OUTPUT **
 			yn[i] = (lpfOutput[i] + lowBandOutput[i] + highBandOutput[i] + hpfOutput[i]);
+
+			FOURBAND_PROFILE_MARK(kSumming);
 		}
 
 		// Add MS signal to output
 
 		// ** MS **
 			// --- compression
-		msOutput[0] = dynamicsProcessor[4].processAudioSample(msOutput[0]);
-		msOutput[1] = dynamicsProcessor[5].processAudioSample(msOutput[1]);
+		double msDetect_dB[2];
+		msDetect_dB[0] = dynamicsProcessor[4].detectLevel(msOutput[0]);
+		msDetect_dB[1] = dynamicsProcessor[5].detectLevel(msOutput[1]);
+
+		FOURBAND_PROFILE_MARK(kDetection);
+
+		msOutput[0] = dynamicsProcessor[4].applyGain(msOutput[0], msDetect_dB[0]);
+		msOutput[1] = dynamicsProcessor[5].applyGain(msOutput[1], msDetect_dB[1]);
+
+		FOURBAND_PROFILE_MARK(kGainComputer);
 
 		// --- saturation
 		if (parameters.saturation[4] > 1)
-			msOutput[0] = tanh(msOutput[0] * k[4]) / tanh(k[4]);
+			msOutput[0] = tanh(msOutput[0] * k[4]) / tanhK[4];
 		if (parameters.saturation[5] > 1)
-			msOutput[1] = tanh(msOutput[1] * k[5]) / tanh(k[5]);
+			msOutput[1] = tanh(msOutput[1] * k[5]) / tanhK[5];
 
+		FOURBAND_PROFILE_MARK(kSaturation);
 
 		yn[0] += 1 * (msOutput[0] + msOutput[1]);
 		yn[1] += 1 * (msOutput[0] - msOutput[1]);
 
+		FOURBAND_PROFILE_MARK(kMidSide);
+
 		// --- Add dry signal to output
 		for (int i = 0; i < 2; i++)
 		{
 			yn[i] += dryInput[i] * dryVolume_cooked;
-			yn[i] *= pow(10, parameters.masterOutputVolume / 20);
+			yn[i] *= masterOutputVolume_cooked;
 		}
 
+		FOURBAND_PROFILE_MARK(kSumming);
+
 		// add master volume
 		
 
@@ -328,6 +663,14 @@ public:
 			parameters.reductionMeter[j] = (params[j].gainReduction * -1) + 1;
 		}
 
+		// --- Input Meters and Analyzer Signals
+		for (int b = 0; b < 4; b++)
+		{
+			parameters.inputMeter[b] = 0.5 * (bandPre[b][0] + bandPre[b][1]);
+			parameters.analyzerPre[b] = parameters.inputMeter[b];
+			parameters.analyzerPost[b] = 0.5 * (bandPost[b][0] + bandPost[b][1]);
+		}
+
 		// --- Output Meters
 		parameters.outputMeter[0] = 0.5 * (lpfOutput[0] + lpfOutput[1]);
 		parameters.outputMeter[1] = 0.5 * (lowBandOutput[0] + lowBandOutput[1]);
@@ -336,7 +679,8 @@ public:
 
 		parameters.masterInputMeter = 0.5 * (inputFrame[0] + inputFrame[1]);
 		parameters.masterOutputMeter = 0.5 * (yn[0] + yn[1]);
-		
+
+		FOURBAND_PROFILE_MARK(kMetering);
 
 		// --- Mono
 		if (inputChannels == 1 &&
@@ -381,58 +725,240 @@ public:
 		return parameters;
 	}
 
+	/** get one dynamics processor's parameters, including its outbound detector and gain reduction values */
+	/**
+	\param index processor index: 0-3 for the bands, 4 = mid, 5 = side
+	\return DynamicsProcessorParameters custom data structure
+	*/
+	DynamicsProcessorParameters getDynamicsParameters(uint32_t index)
+	{
+		return dynamicsProcessor[index < 6 ? index : 5].getParameters();
+	}
+
 	/** set parameters: note use of custom structure for passing param data */
 	/**
 	\param FourBandDynamicsParameters custom data structure
 	*/
 	void setParameters(const FourBandDynamicsParameters& params)
 	{
-		// --- copy them; note you may choose to ignore certain items
-		//     and copy the variables one at a time, or you may test
-		//     to see if cook-able variables have changed; if not, then
-		//     do not re-cook them as it just wastes CPU
+		// --- a preset glide is running: retarget it rather than jumping
+		if (morphGlide)
+		{
+			glideTo = params;
+			return;
+		}
 
+		// --- save them; the cooking happens at control rate in updateControlRate()
 		parameters = params;
-		
-		// ** COMPRESSOR **
-		DynamicsProcessorParameters dynaParams[6];
+		cookPending = true;
+	}
+
+	/** glide from the current settings to a new parameter set, e.g. when a preset is loaded */
+	/**
+	\param params the target parameters
+	\param morphTime_mSec glide time; 0.0 jumps on the next control rate update
+	*/
+	void morphToParameters(const FourBandDynamicsParameters& params, double morphTime_mSec)
+	{
+		glideFrom = parameters;
+		glideTo = params;
+		glideAmount = 0.0;
+		glideIncrement = getMorphIncrement(morphTime_mSec);
+		morphGlide = true;
+	}
+
+	/** set the two snapshots used by the A/B morph */
+	void setMorphSnapshots(const FourBandDynamicsParameters& paramsA, const FourBandDynamicsParameters& paramsB)
+	{
+		morphA = paramsA;
+		morphB = paramsB;
+		morphDirty = true;
+	}
+
+	/** enable/disable the A/B morph; while enabled, setParameters( ) is ignored in favor of the snapshots */
+	void enableMorph(bool enable)
+	{
+		if (morphEnabled == enable)
+			return;
+
+		morphEnabled = enable;
+		morphDirty = true;
+		if (!enable)
+			cookPending = true;
+
+		// --- the snapshots take over from any preset glide
+		if (enable)
+			morphGlide = false;
+	}
+
+	/** set the A/B morph position (0.0 = A, 1.0 = B); the position glides there at the morph time rate */
+	/**
+	\param amount the new morph position
+	\param morphTime_mSec time to sweep from A to B
+	*/
+	void setMorphAmount(double amount, double morphTime_mSec)
+	{
+		boundValue(amount, 0.0, 1.0);
+		if (amount == morphAmountTarget && morphTime_mSec == morphTime)
+			return;
+
+		morphAmountTarget = amount;
+		setMorphTime(morphTime_mSec);
+		morphDirty = true;
+	}
+
+	/** query for a morph in progress */
+	bool isMorphing() { return morphGlide || (morphEnabled && morphDirty); }
+
+	// --- per-stage profiling (FOURBAND_DYNAMICS_PROFILING builds); the frames processed since the
+	//     last endProfileBlock( ) count as one block, so call it once per buffer from the audio thread
+#ifdef FOURBAND_DYNAMICS_PROFILING
+	/** close the current block and push its stage timings into the histograms */
+	void endProfileBlock() { profiler.endBlock(); }
+
+	/** copy one stage's timing histogram; safe from the GUI thread */
+	bool getStageProfile(dynamicsStage stage, DynamicsStageProfile& profile) const
+	{
+		profiler.getStageProfile(stage, profile);
+		return true;
+	}
 
+	/** clear the histograms (takes effect at the next endProfileBlock( )); safe from the GUI thread */
+	void resetProfile() { profiler.reset(); }
+
+	/** unit of the profile ticks: "cycles" (TSC) or "ns" */
+	static const char* getProfileTickUnit() { return DynamicsProfiler::getTickUnit(); }
+#else
+	void endProfileBlock() {}
+	bool getStageProfile(dynamicsStage, DynamicsStageProfile&) const { return false; }
+	void resetProfile() {}
+	static const char* getProfileTickUnit() { return ""; }
+#endif
+
+private:
+	/** convert a morph time to a per-update increment for a 0.0 to 1.0 position */
+	double getMorphIncrement(double morphTime_mSec)
+	{
+		double updates = (morphTime_mSec * 0.001 * sampleRate) / CONTROL_RATE_INTERVAL;
+		return updates > 1.0 ? 1.0 / updates : 1.0;
+	}
+
+	/** set the A/B morph time */
+	void setMorphTime(double morphTime_mSec)
+	{
+		morphTime = morphTime_mSec;
+		morphIncrement = getMorphIncrement(morphTime_mSec);
+	}
+
+	/** morph between two parameter sets into our parameters, keeping our outbound meter values, and cook them */
+	void applyMorph(const FourBandDynamicsParameters& paramsA, const FourBandDynamicsParameters& paramsB, double amount)
+	{
+		FourBandDynamicsParameters morphed = morphParameters(paramsA, paramsB, amount);
 		for (int i = 0; i < 6; i++)
 		{
+			morphed.inputMeter[i] = parameters.inputMeter[i];
+			morphed.outputMeter[i] = parameters.outputMeter[i];
+			morphed.reductionMeter[i] = parameters.reductionMeter[i];
+		}
+		for (int i = 0; i < 4; i++)
+		{
+			morphed.analyzerPre[i] = parameters.analyzerPre[i];
+			morphed.analyzerPost[i] = parameters.analyzerPost[i];
+		}
+		morphed.masterInputMeter = parameters.masterInputMeter;
+		morphed.masterOutputMeter = parameters.masterOutputMeter;
+		parameters = morphed;
 
-			k[i] = parameters.saturation[i];
+		cookParameters();
+		cookPending = false;
+	}
 
-			dynaParams[i] = dynamicsProcessor[i].getParameters();
+	/** called once per CONTROL_RATE_INTERVAL samples: advance any morph and cook dirty parameters */
+	void updateControlRate()
+	{
+		// --- A/B morph between the stored snapshots
+		if (morphEnabled && morphDirty)
+		{
+			// --- move the position towards the target
+			if (morphAmount < morphAmountTarget)
+				morphAmount = fmin(morphAmount + morphIncrement, morphAmountTarget);
+			else if (morphAmount > morphAmountTarget)
+				morphAmount = fmax(morphAmount - morphIncrement, morphAmountTarget);
 
-			dynaParams[i].threshold_dB = parameters.threshold[i];
-			dynaParams[i].ratio = parameters.ratio[i];
-			dynaParams[i].attackTime_mSec = parameters.attack[i];
-			dynaParams[i].releaseTime_mSec = parameters.release[i];
-			dynaParams[i].outputGain_dB = parameters.gain[i];
-			dynaParams[i].kneeWidth_dB = parameters.knee[i];
+			if (morphAmount == morphAmountTarget)
+				morphDirty = false;
 
-			dynaParams[i].hardLimitGate = parameters.hardLimitGate[i];
-			dynaParams[i].calculation = convertIntToEnum(parameters.dynamicsMode[i], dynamicsProcessorType);
+			applyMorph(morphA, morphB, morphAmount);
+			return;
+		}
 
-			dynamicsProcessor[i].setParameters(dynaParams[i]);
+		// --- preset glide; uses its own start/target so the A/B snapshots are left alone
+		if (morphGlide)
+		{
+			glideAmount = fmin(glideAmount + glideIncrement, 1.0);
+			if (glideAmount >= 1.0)
+				morphGlide = false;
 
+			applyMorph(glideFrom, glideTo, glideAmount);
+			return;
+		}
+
+		if (cookPending)
+		{
+			cookParameters();
+			cookPending = false;
+		}
+	}
+
+	/** cook the parameters into the member objects */
+	void cookParameters()
+	{
+		// ** COMPRESSOR **
+		DynamicsProcessorParameters dynaParams;
+
+		for (int i = 0; i < 6; i++)
+		{
+			k[i] = parameters.saturation[i];
+			tanhK[i] = tanh(k[i]);
+
+			dynaParams = dynamicsProcessor[i].getParameters();
+
+			dynamicsProcessorType calculation = convertIntToEnum(parameters.dynamicsMode[i], dynamicsProcessorType);
+
+			// --- skip the (time constant) re-cook if nothing changed
+			if (dynaParams.threshold_dB == parameters.threshold[i] &&
+				dynaParams.ratio == parameters.ratio[i] &&
+				dynaParams.attackTime_mSec == parameters.attack[i] &&
+				dynaParams.releaseTime_mSec == parameters.release[i] &&
+				dynaParams.outputGain_dB == parameters.gain[i] &&
+				dynaParams.kneeWidth_dB == parameters.knee[i] &&
+				dynaParams.hardLimitGate == parameters.hardLimitGate[i] &&
+				dynaParams.calculation == calculation)
+				continue;
+
+			dynaParams.threshold_dB = parameters.threshold[i];
+			dynaParams.ratio = parameters.ratio[i];
+			dynaParams.attackTime_mSec = parameters.attack[i];
+			dynaParams.releaseTime_mSec = parameters.release[i];
+			dynaParams.outputGain_dB = parameters.gain[i];
+			dynaParams.kneeWidth_dB = parameters.knee[i];
+
+			dynaParams.hardLimitGate = parameters.hardLimitGate[i];
+			dynaParams.calculation = calculation;
+
+			dynamicsProcessor[i].setParameters(dynaParams);
 		}
-		
 
 		// ** FILTERBANK **
 		// --- set range of dry volume
 		if (parameters.dryVolume <= -15.0)
-			dryVolume_cooked = 0.0;	
+			dryVolume_cooked = 0.0;
 		else
 			dryVolume_cooked = pow(10, parameters.dryVolume / 20);
-		
-		
-		// --- set filter frequency
-		LRFilterBankParameters bankParams[3];
 
-		for (int i = 0; i < 3; i++)
-			bankParams[i] = splitterFilters[i * 2].getParameters();
-		
+		masterOutputVolume_cooked = pow(10, parameters.masterOutputVolume / 20);
+
+		// --- set filter frequency
 		for (int i = 0; i < 2; i++)
 		{
 			if (parameters.splitF[i] > parameters.splitF[i + 1])
@@ -444,21 +970,22 @@ public:
 			if (parameters.splitF[i] < parameters.splitF[i - 1])
 				parameters.splitF[i] = parameters.splitF[i - 1];
 		}
-		
+
+		// --- one L/R pair of splitters per split frequency; these only set the
+		//     smoothing targets, the splitters glide per sample
 		for (int i = 0; i < 3; i++)
-			bankParams[i].splitFrequency = parameters.splitF[i];
+		{
+			TPTCrossoverParameters bankParams = splitterFilters[i * 2].getParameters();
+			if (bankParams.splitFrequency == parameters.splitF[i])
+				continue;
 
-		splitterFilters[0].setParameters(bankParams[0]);
-		splitterFilters[1].setParameters(bankParams[0]);
-		splitterFilters[2].setParameters(bankParams[1]);
-		splitterFilters[3].setParameters(bankParams[1]);
-		splitterFilters[4].setParameters(bankParams[2]);
-		splitterFilters[5].setParameters(bankParams[2]);
+			bankParams.splitFrequency = parameters.splitF[i];
 
+			splitterFilters[i * 2].setParameters(bankParams);
+			splitterFilters[i * 2 + 1].setParameters(bankParams);
+		}
 	}
 
-
-private:
 	FourBandDynamicsParameters parameters; ///< object parameters
 
 	// ** COMPRESSOR **
@@ -468,11 +995,38 @@ private:
 
 
 	// ** FILTERBANK **
-	LRFilterBank splitterFilters[6];
+	TPTCrossover splitterFilters[6];
 	
 	double volume_cooked[4];
 	double dryVolume_cooked = 0.0;
+	double masterOutputVolume_cooked = 1.0;
 	double k[6];
+	double tanhK[6];
+
+	// --- control rate cooking
+	unsigned int controlRateCounter = 0;	///< counts samples to the next control rate update
+	bool cookPending = true;				///< parameters changed since the last cook
+
+	// --- preset morphing
+	FourBandDynamicsParameters morphA;	///< morph snapshot at position 0.0
+	FourBandDynamicsParameters morphB;	///< morph snapshot at position 1.0
+	double morphAmount = 0.0;			///< current morph position
+	double morphAmountTarget = 0.0;		///< morph position we are gliding to
+	double morphIncrement = 1.0;		///< position change per control rate update
+	double morphTime = 0.0;				///< time to sweep from A to B in mSec
+	bool morphEnabled = false;			///< A/B morph is driving the parameters
+	bool morphGlide = false;			///< one-shot glide (preset change) in progress
+	bool morphDirty = false;			///< morph position or snapshots changed
+
+	// --- preset glide
+	FourBandDynamicsParameters glideFrom;	///< parameters when the glide started
+	FourBandDynamicsParameters glideTo;		///< parameters the glide ends on
+	double glideAmount = 0.0;				///< glide position from 0.0 to 1.0
+	double glideIncrement = 1.0;			///< glide position change per control rate update
+
+#ifdef FOURBAND_DYNAMICS_PROFILING
+	DynamicsProfiler profiler;			///< per-stage timings
+#endif
 
 	// --- local variables used by this object
 	double sampleRate = 0.0;	///< sample rate
@@ -29,101 +29,73 @@
 3) lastly, update the states of the z^-1 registers in the state array just before returning\n
 
 - NOTES:\n
-the storageComponent or "S" value is used for Zavalishin's VA filters and is only
-available on two of the forms: direct and transposed canonical\n
+the math for each structure lives in the BiquadKernel specializations; this function only selects one\n
 
 \param xn the input sample x(n)
 \returns the biquad processed output y(n)
 */
 double Biquad::processAudioSample(double xn)
 {
-	if (parameters.biquadCalcType == biquadAlgorithm::kDirect)
+	switch (parameters.biquadCalcType)
 	{
-		// --- 1)  form output y(n) = a0*x(n) + a1*x(n-1) + a2*x(n-2) - b1*y(n-1) - b2*y(n-2)
-		storageComponent =  coeffArray[a1] * stateArray[x_z1] +
-							coeffArray[a2] * stateArray[x_z2] -
-							coeffArray[b1] * stateArray[y_z1] -
-							coeffArray[b2] * stateArray[y_z2];
-
-		double yn = coeffArray[a0] * xn + storageComponent;
-
-		// --- 2) underflow check
-		checkFloatUnderflow(yn);
-
-		// --- 3) update states
-		stateArray[x_z2] = stateArray[x_z1];
-		stateArray[x_z1] = xn;
-
-		stateArray[y_z2] = stateArray[y_z1];
-		stateArray[y_z1] = yn;
-
-		// --- return value
-		return yn;
+		case biquadAlgorithm::kDirect:
+			return BiquadKernel<biquadAlgorithm::kDirect>::processSample(&coeffArray[0], &stateArray[0], xn);
+		case biquadAlgorithm::kCanonical:
+			return BiquadKernel<biquadAlgorithm::kCanonical>::processSample(&coeffArray[0], &stateArray[0], xn);
+		case biquadAlgorithm::kTransposeDirect:
+			return BiquadKernel<biquadAlgorithm::kTransposeDirect>::processSample(&coeffArray[0], &stateArray[0], xn);
+		case biquadAlgorithm::kTransposeCanonical:
+			return BiquadKernel<biquadAlgorithm::kTransposeCanonical>::processSample(&coeffArray[0], &stateArray[0], xn);
 	}
-	else if (parameters.biquadCalcType == biquadAlgorithm::kCanonical)
-	{
-		storageComponent = 0.0;
-
-		// --- 1)  form output y(n) = a0*w(n) + m_f_a1*stateArray[x_z1] + m_f_a2*stateArray[x_z2][x_z2];
-		//
-		// --- w(n) = x(n) - b1*stateArray[x_z1] - b2*stateArray[x_z2]
-		double wn = xn - coeffArray[b1] * stateArray[x_z1] - coeffArray[b2] * stateArray[x_z2];
-
-		// --- y(n):
-		double yn = coeffArray[a0] * wn + coeffArray[a1] * stateArray[x_z1] + coeffArray[a2] * stateArray[x_z2];
-
-		// --- 2) underflow check
-		checkFloatUnderflow(yn);
+	return xn; // didn't process anything :(
+}
 
-		// --- 3) update states
-		stateArray[x_z2] = stateArray[x_z1];
-		stateArray[x_z1] = wn;
+/**
+\brief process a block through the biquad; the structure is selected once, then the kernel runs the whole block
 
-		// --- return value
-		return yn;
-	}
-	else if (parameters.biquadCalcType == biquadAlgorithm::kTransposeDirect)
+\param in input buffer
+\param out output buffer (may be the same as in)
+\param count number of samples
+*/
+void Biquad::processAudioBlock(const double* in, double* out, uint32_t count)
+{
+	switch (parameters.biquadCalcType)
 	{
-		storageComponent = 0.0;
-		// --- 1)  form output y(n) = a0*w(n) + stateArray[x_z1]
-		//
-		// --- w(n) = x(n) + stateArray[y_z1]
-		double wn = xn + stateArray[y_z1];
-
-		// --- y(n) = a0*w(n) + stateArray[x_z1]
-		double yn = coeffArray[a0] * wn + stateArray[x_z1];
-
-		// --- 2) underflow check
-		checkFloatUnderflow(yn);
-
-		// --- 3) update states
-		stateArray[y_z1] = stateArray[y_z2] - coeffArray[b1] * wn;
-		stateArray[y_z2] = -coeffArray[b2] * wn;
-
-		stateArray[x_z1] = stateArray[x_z2] + coeffArray[a1] * wn;
-		stateArray[x_z2] = coeffArray[a2] * wn;
-
-		// --- return value
-		return yn;
+		case biquadAlgorithm::kDirect:
+			BiquadKernel<biquadAlgorithm::kDirect>::processBlock(&coeffArray[0], &stateArray[0], in, out, count);
+			return;
+		case biquadAlgorithm::kCanonical:
+			BiquadKernel<biquadAlgorithm::kCanonical>::processBlock(&coeffArray[0], &stateArray[0], in, out, count);
+			return;
+		case biquadAlgorithm::kTransposeDirect:
+			BiquadKernel<biquadAlgorithm::kTransposeDirect>::processBlock(&coeffArray[0], &stateArray[0], in, out, count);
+			return;
+		case biquadAlgorithm::kTransposeCanonical:
+			BiquadKernel<biquadAlgorithm::kTransposeCanonical>::processBlock(&coeffArray[0], &stateArray[0], in, out, count);
+			return;
 	}
-	else if (parameters.biquadCalcType == biquadAlgorithm::kTransposeCanonical)
-	{
-		// --- 1)  form output y(n) = a0*x(n) + stateArray[x_z1]
-		storageComponent = stateArray[x_z1];
-
-		double yn = coeffArray[a0] * xn + storageComponent;// stateArray[x_z1];
+	if (out != in)
+		memcpy(out, in, sizeof(double)*count);
+}
 
-		// --- 2) underflow check
-		checkFloatUnderflow(yn);
+/**
+\brief the S (storage) value for Harma filters, computed from the current state
 
-		// --- shuffle/update
-		stateArray[x_z1] = coeffArray[a1]*xn - coeffArray[b1]*yn + stateArray[x_z2];
-		stateArray[x_z2] = coeffArray[a2]*xn - coeffArray[b2]*yn;
+- only the direct and transposed canonical forms have a storage component; the others return 0.0
 
-		// --- return value
-		return yn;
+\returns the storage value S
+*/
+double Biquad::getS_value()
+{
+	switch (parameters.biquadCalcType)
+	{
+		case biquadAlgorithm::kDirect:
+			return BiquadKernel<biquadAlgorithm::kDirect>::getStorage(&coeffArray[0], &stateArray[0]);
+		case biquadAlgorithm::kTransposeCanonical:
+			return BiquadKernel<biquadAlgorithm::kTransposeCanonical>::getStorage(&coeffArray[0], &stateArray[0]);
+		default:
+			return 0.0;
 	}
-	return xn; // didn't process anything :(
 }
 
 // --- returns true if coeffs were updated
@@ -957,6 +929,28 @@ void AudioDetector::setReleaseTime(double release_in_ms, bool forceCalc)
 	releaseTime = exp(TLD_AUDIO_ENVELOPE_ANALOG_TC / (release_in_ms * sampleRate * 0.001));
 }
 
+// --- one sine cycle plus a guard point, shared by every LFO; a fixed array filled at load time, so the
+//     audio thread never allocates it or waits on a static-init guard
+static double lfoSineTable[LFO_WAVETABLE_LEN + 1];
+static const bool lfoSineTableFilled = []()
+{
+	for (unsigned int i = 0; i <= LFO_WAVETABLE_LEN; i++)
+		lfoSineTable[i] = sin(2.0 * kPi * i / LFO_WAVETABLE_LEN);
+	return true;
+}();
+
+/**
+\brief linear-interpolated sin(2 pi phase) from the shared table; phase is [0.0, +1.0]
+*/
+static inline double lookupLFOSine(const double* table, double phase)
+{
+	double index = phase * LFO_WAVETABLE_LEN;
+	unsigned int i = (unsigned int)index;
+	if (i >= LFO_WAVETABLE_LEN) i = LFO_WAVETABLE_LEN - 1;
+	double frac = index - i;
+	return table[i] + frac * (table[i + 1] - table[i]);
+}
+
 /**
 \brief generates the oscillator output for one sample interval; note that there are multiple outputs.
 */
@@ -977,17 +971,12 @@ const SignalGenData LFO::renderAudioOutput()
 	// --- calculate the oscillator value
 	if (waveform == generatorWaveform::kSin)
 	{
-		// --- calculate normal angle
-		double angle = modCounter*2.0*kPi - kPi;
-
-		// --- norm output with parabolicSine approximation
-		output.normalOutput = parabolicSine(-angle);
-
-		// --- calculate QP angle
-		angle = modCounterQP*2.0*kPi - kPi;
+		// --- norm output from the wavetable
+		const double* table = lfoSineTable;
+		output.normalOutput = lookupLFOSine(table, modCounter);
 
 		// --- calc QP output
-		output.quadPhaseOutput_pos = parabolicSine(-angle);
+		output.quadPhaseOutput_pos = lookupLFOSine(table, modCounterQP);
 	}
 	else if (waveform == generatorWaveform::kTriangle)
 	{
@@ -1019,29 +1008,812 @@ const SignalGenData LFO::renderAudioOutput()
 	return output;
 }
 
+/**
+\brief renders a block of modulation values; the phase ramp is computed directly (no per-sample wrap branch)
+       so each waveform loop vectorizes apart from the table reads
+
+\param normalOutput - buffer for the normal output, or nullptr
+\param quadPhaseOutput - buffer for the +90 degree output, or nullptr
+\param count - number of samples
+*/
+void LFO::renderModulationBlock(double* normalOutput, double* quadPhaseOutput, uint32_t count)
+{
+	// --- always first!
+	checkAndWrapModulo(modCounter, phaseInc);
+	const double start = modCounter;
+	const generatorWaveform waveform = lfoParameters.waveform;
+	const double* table = lfoSineTable;
+
+	for (unsigned int output = 0; output < 2; output++)
+	{
+		double* buffer = output == 0 ? normalOutput : quadPhaseOutput;
+		if (!buffer)
+			continue;
+
+		const double offset = output == 0 ? start : start + 0.25;
+		for (uint32_t n = 0; n < count; n++)
+		{
+			double phase = offset + n * phaseInc;
+			buffer[n] = phase - floor(phase);
+		}
+
+		if (waveform == generatorWaveform::kSin)
+		{
+			for (uint32_t n = 0; n < count; n++)
+				buffer[n] = lookupLFOSine(table, buffer[n]);
+		}
+		else if (waveform == generatorWaveform::kTriangle)
+		{
+			// --- bipolar triangle from the trivial saw
+			for (uint32_t n = 0; n < count; n++)
+				buffer[n] = 2.0*fabs(unipolarToBipolar(buffer[n])) - 1.0;
+		}
+		else if (waveform == generatorWaveform::kSaw)
+		{
+			for (uint32_t n = 0; n < count; n++)
+				buffer[n] = unipolarToBipolar(buffer[n]);
+		}
+	}
+
+	// --- setup for next block
+	modCounter = start + count * phaseInc;
+	modCounter -= floor(modCounter);
+}
+
 
 #ifdef HAVE_FFTW
 
+/**
+\brief returns the process-wide registry; created on first use (thread-safe static init)
+*/
+FFTPlanRegistry& FFTPlanRegistry::getInstance()
+{
+	static FFTPlanRegistry registry;
+	return registry;
+}
+
+/**
+\brief constructs the registry; imports FFTW_WISDOM_FILE if it is defined
+*/
+FFTPlanRegistry::FFTPlanRegistry()
+{
+#ifdef FFTW_WISDOM_FILE
+	setWisdomFile(FFTW_WISDOM_FILE);
+#endif
+}
+
+/**
+\brief destroys every plan; runs at process exit, after the last FFT object is gone
+*/
+FFTPlanRegistry::~FFTPlanRegistry()
+{
+	for (auto& entry : plans)
+		fftw_destroy_plan(entry.second);
+	plans.clear();
+}
+
+/**
+\brief get the shared plan for a transform, creating it on first request
+
+- NOTES:<br>
+Plans are out-of-place; execute them with the new-array functions on fftw_malloc( ) buffers.<br>
+
+\param length the transform length (real length for r2c/c2r)
+\param type the transform type
+\returns the plan, or nullptr if FFTW could not make one
+*/
+fftw_plan FFTPlanRegistry::getPlan(unsigned int length, fftPlanType type)
+{
+	const unsigned long long key = ((unsigned long long)length << 2) | (unsigned long long)type;
+
+	std::lock_guard<std::mutex> lock(plannerMutex);
+	auto it = plans.find(key);
+	if (it != plans.end())
+		return it->second;
+
+	fftw_plan plan = createPlan(length, type);
+	if (!plan)
+		return nullptr;
+
+	plans[key] = plan;
+
+	// --- persist what we just measured
+	if (!wisdomFile.empty())
+		fftw_export_wisdom_to_filename(wisdomFile.c_str());
+
+	return plan;
+}
+
+/**
+\brief create a plan on scratch buffers; FFTW_MEASURE overwrites them, which is why they are not the caller's
+
+\param length the transform length
+\param type the transform type
+\returns the new plan
+*/
+fftw_plan FFTPlanRegistry::createPlan(unsigned int length, fftPlanType type)
+{
+	fftw_plan plan = nullptr;
+	if (type == fftPlanType::kRealForward || type == fftPlanType::kRealInverse)
+	{
+		double* real = (double*)fftw_malloc(sizeof(double) * length);
+		fftw_complex* spectrum = (fftw_complex*)fftw_malloc(sizeof(fftw_complex) * (length / 2 + 1));
+
+		if (type == fftPlanType::kRealForward)
+			plan = fftw_plan_dft_r2c_1d(length, real, spectrum, plannerFlags);
+		else
+			plan = fftw_plan_dft_c2r_1d(length, spectrum, real, plannerFlags);
+
+		fftw_free(real);
+		fftw_free(spectrum);
+	}
+	else
+	{
+		fftw_complex* in = (fftw_complex*)fftw_malloc(sizeof(fftw_complex) * length);
+		fftw_complex* out = (fftw_complex*)fftw_malloc(sizeof(fftw_complex) * length);
+
+		plan = fftw_plan_dft_1d(length, in, out, type == fftPlanType::kComplexForward ? FFTW_FORWARD : FFTW_BACKWARD, plannerFlags);
+
+		fftw_free(in);
+		fftw_free(out);
+	}
+
+	return plan;
+}
+
+/**
+\brief set the planner flags for plans created from now on (existing plans are kept)
+
+\param flags FFTW planner flags, e.g. FFTW_ESTIMATE, FFTW_MEASURE, FFTW_PATIENT
+*/
+void FFTPlanRegistry::setPlannerFlags(unsigned int flags)
+{
+	std::lock_guard<std::mutex> lock(plannerMutex);
+	plannerFlags = flags;
+}
+
+/**
+\brief import wisdom from a file now and re-export it whenever a new plan is created
+
+\param filename the wisdom file, or nullptr to stop persisting
+\returns true if the file was read
+*/
+bool FFTPlanRegistry::setWisdomFile(const char* filename)
+{
+	std::lock_guard<std::mutex> lock(plannerMutex);
+	wisdomFile = filename ? filename : "";
+	if (wisdomFile.empty())
+		return false;
+
+	return fftw_import_wisdom_from_filename(wisdomFile.c_str()) != 0;
+}
+
+/**
+\brief import wisdom from a file
+
+\param filename the wisdom file
+\returns true if the file was read
+*/
+bool FFTPlanRegistry::importWisdom(const char* filename)
+{
+	std::lock_guard<std::mutex> lock(plannerMutex);
+	return filename && fftw_import_wisdom_from_filename(filename) != 0;
+}
+
+/**
+\brief export the accumulated wisdom to a file
+
+\param filename the wisdom file
+\returns true if the file was written
+*/
+bool FFTPlanRegistry::exportWisdom(const char* filename)
+{
+	std::lock_guard<std::mutex> lock(plannerMutex);
+	return filename && fftw_export_wisdom_to_filename(filename) != 0;
+}
+
+/**
+\brief allocate the buffers and get the shared r2c/c2r plans; not real-time safe
+
+\param _partitionLength head and partition length; must be a power of 2 (>= 4)
+\param _maxIRLength longest IR that can be loaded without re-initializing
+*/
+void PartitionedConvolver::initialize(unsigned int _partitionLength, unsigned int _maxIRLength)
+{
+	destroyFFTW();
+
+	partitionLength = _partitionLength < 4 ? 4 : _partitionLength;
+	fftLength = partitionLength * 2;
+	numBins = partitionLength + 1;
+	maxPartitions = _maxIRLength > partitionLength ? (_maxIRLength - partitionLength + partitionLength - 1) / partitionLength : 0;
+	numPartitions = 0;
+	irLength = 0;
+
+	// --- one zeroed arena block for everything; its alignment satisfies the FFTW new-array functions
+	//     at least one delay line slot so the pointers are valid
+	unsigned int slots = maxPartitions > 0 ? maxPartitions : 1;
+	arena.prepare(3 * AudioArena::getAllocationSize<double>(fftLength) +
+				  2 * AudioArena::getAllocationSize<fftw_complex>(numBins) +
+				  2 * AudioArena::getAllocationSize<double>(partitionLength) +
+				  AudioArena::getAllocationSize<double>(partitionLength * 2) +
+				  4 * AudioArena::getAllocationSize<double>(slots * numBins) +
+				  2 * AudioArena::getAllocationSize<double>(numBins));
+
+	// --- buffers for the transforms
+	inputFrame = arena.allocate<double>(fftLength);
+	irFrame = arena.allocate<double>(fftLength);
+	ifftOutput = arena.allocate<double>(fftLength);
+	spectrum = arena.allocate<fftw_complex>(numBins);
+	accumulator = arena.allocate<fftw_complex>(numBins);
+
+	plan_forward = FFTPlanRegistry::getInstance().getPlan(fftLength, fftPlanType::kRealForward);
+	plan_backward = FFTPlanRegistry::getInstance().getPlan(fftLength, fftPlanType::kRealInverse);
+
+	// --- head, history and tail
+	headReversed = arena.allocate<double>(partitionLength);
+	history = arena.allocate<double>(partitionLength * 2);
+	tailOutput = arena.allocate<double>(partitionLength);
+
+	// --- split complex partition spectra and delay line
+	fdlReal = arena.allocate<double>(slots * numBins);
+	fdlImag = arena.allocate<double>(slots * numBins);
+	irReal = arena.allocate<double>(slots * numBins);
+	irImag = arena.allocate<double>(slots * numBins);
+	accReal = arena.allocate<double>(numBins);
+	accImag = arena.allocate<double>(numBins);
+
+	reset();
+}
+
+/**
+\brief destroys the FFTW plans and all buffers
+*/
+void PartitionedConvolver::destroyFFTW()
+{
+	// --- the plans belong to the FFTPlanRegistry
+	plan_forward = nullptr;
+	plan_backward = nullptr;
+
+	// --- every buffer lives in the arena
+	arena.release();
+	inputFrame = nullptr; irFrame = nullptr; ifftOutput = nullptr;
+	spectrum = nullptr; accumulator = nullptr;
+	headReversed = nullptr; history = nullptr; tailOutput = nullptr;
+	fdlReal = nullptr; fdlImag = nullptr; irReal = nullptr; irImag = nullptr;
+	accReal = nullptr; accImag = nullptr;
+}
+
+/**
+\brief flush the signal history, input frame, delay line and pending tail; the IR is kept
+*/
+void PartitionedConvolver::reset()
+{
+	if (!history)
+		return;
+
+	memset(history, 0, sizeof(double) * partitionLength * 2);
+	memset(tailOutput, 0, sizeof(double) * partitionLength);
+	memset(inputFrame, 0, sizeof(double) * fftLength);
+
+	unsigned int slots = maxPartitions > 0 ? maxPartitions : 1;
+	memset(fdlReal, 0, sizeof(double) * slots * numBins);
+	memset(fdlImag, 0, sizeof(double) * slots * numBins);
+
+	historyIndex = 0;
+	blockIndex = 0;
+	fdlIndex = 0;
+}
+
+/**
+\brief load an impulse response: the head is stored reversed for the direct form FIR and the
+remaining taps are transformed into partition spectra (scaled by 1/fftLength so the c2r needs no normalization)
+
+- allocation-free as long as irLength fits the capacity set in initialize( )
+
+\param irArray the impulse response
+\param _irLength length of the impulse response
+*/
+void PartitionedConvolver::setImpulseResponse(const double* irArray, unsigned int _irLength)
+{
+	if (!irArray)
+		return;
+
+	if (!history || _irLength > partitionLength * (maxPartitions + 1))
+		initialize(partitionLength > 0 ? partitionLength : CONVOLVER_PARTITION_LEN, _irLength);
+
+	irLength = _irLength;
+
+	// --- head
+	for (unsigned int i = 0; i < partitionLength; i++)
+		headReversed[partitionLength - 1 - i] = i < irLength ? irArray[i] : 0.0;
+
+	// --- tail partitions
+	unsigned int previousPartitions = numPartitions;
+	numPartitions = irLength > partitionLength ? (irLength - 1) / partitionLength : 0;
+	const double scale = 1.0 / fftLength;
+
+	// --- drop the pending tail of the old IR; with no partitions left processPartitions( ) never rewrites it
+	if (numPartitions < previousPartitions)
+		memset(tailOutput, 0, sizeof(double) * partitionLength);
+
+	// --- the delay line is not updated while there is no tail, so it holds stale spectra
+	if (previousPartitions == 0 && numPartitions > 0)
+	{
+		memset(fdlReal, 0, sizeof(double) * maxPartitions * numBins);
+		memset(fdlImag, 0, sizeof(double) * maxPartitions * numBins);
+	}
+
+	for (unsigned int p = 0; p < numPartitions; p++)
+	{
+		unsigned int start = partitionLength * (p + 1);
+		memset(irFrame, 0, sizeof(double) * fftLength);
+		for (unsigned int i = 0; i < partitionLength && start + i < irLength; i++)
+			irFrame[i] = irArray[start + i];
+
+		fftw_execute_dft_r2c(plan_forward, irFrame, spectrum);
+
+		double* re = &irReal[p * numBins];
+		double* im = &irImag[p * numBins];
+		for (unsigned int k = 0; k < numBins; k++)
+		{
+			re[k] = spectrum[k][0] * scale;
+			im[k] = spectrum[k][1] * scale;
+		}
+	}
+}
+
+/**
+\brief end of block: FFT the [previous | current] input frame into the delay line, multiply-accumulate
+against the partition spectra and inverse FFT; the last half (overlap-save) is the tail for the next block
+*/
+void PartitionedConvolver::processPartitions()
+{
+	if (numPartitions == 0)
+	{
+		memcpy(inputFrame, inputFrame + partitionLength, sizeof(double) * partitionLength);
+		return;
+	}
+
+	fftw_execute_dft_r2c(plan_forward, inputFrame, spectrum);
+
+	// --- newest spectrum goes one slot back; older ones are at increasing offsets
+	fdlIndex = fdlIndex == 0 ? maxPartitions - 1 : fdlIndex - 1;
+	double* newestReal = &fdlReal[fdlIndex * numBins];
+	double* newestImag = &fdlImag[fdlIndex * numBins];
+	for (unsigned int k = 0; k < numBins; k++)
+	{
+		newestReal[k] = spectrum[k][0];
+		newestImag[k] = spectrum[k][1];
+	}
+
+	memset(accReal, 0, sizeof(double) * numBins);
+	memset(accImag, 0, sizeof(double) * numBins);
+
+	for (unsigned int p = 0; p < numPartitions; p++)
+	{
+		unsigned int slot = fdlIndex + p;
+		if (slot >= maxPartitions)
+			slot -= maxPartitions;
+
+		complexMultiplyAccumulate(&fdlReal[slot * numBins], &fdlImag[slot * numBins],
+								  &irReal[p * numBins], &irImag[p * numBins], accReal, accImag, numBins);
+	}
+
+	for (unsigned int k = 0; k < numBins; k++)
+	{
+		accumulator[k][0] = accReal[k];
+		accumulator[k][1] = accImag[k];
+	}
+
+	fftw_execute_dft_c2r(plan_backward, accumulator, ifftOutput);
+
+	memcpy(tailOutput, ifftOutput + partitionLength, sizeof(double) * partitionLength);
+	memcpy(inputFrame, inputFrame + partitionLength, sizeof(double) * partitionLength);
+}
+
+/**
+\brief allocate the buffers and create the r2c/c2r plans; not real-time safe
+
+\param _partitionLength partition length B
+\param _numPartitions number of partitions in the segment
+\param _workerSignal semaphore of the worker thread, or nullptr to run the jobs inline
+*/
+void ConvolutionStage::initialize(unsigned int _partitionLength, unsigned int _numPartitions, moodycamel::spsc_sema::LightweightSemaphore* _workerSignal)
+{
+	destroyFFTW();
+
+	partitionLength = _partitionLength;
+	fftLength = partitionLength * 2;
+	numBins = partitionLength + 1;
+	numPartitions = _numPartitions > 0 ? _numPartitions : 1;
+	workerSignal = _workerSignal;
+	xrunCount.store(0, std::memory_order_relaxed);
+
+	// --- one zeroed arena block for everything; its alignment satisfies the FFTW new-array functions
+	arena.prepare(3 * AudioArena::getAllocationSize<double>(fftLength) +
+				  2 * AudioArena::getAllocationSize<fftw_complex>(numBins) +
+				  4 * AudioArena::getAllocationSize<double>(numPartitions * numBins) +
+				  2 * AudioArena::getAllocationSize<double>(numBins) +
+				  AudioArena::getAllocationSize<double>(partitionLength * 2));
+
+	inputFrame = arena.allocate<double>(fftLength);
+	jobFrame = arena.allocate<double>(fftLength);
+	ifftOutput = arena.allocate<double>(fftLength);
+	spectrum = arena.allocate<fftw_complex>(numBins);
+	accumulator = arena.allocate<fftw_complex>(numBins);
+
+	plan_forward = FFTPlanRegistry::getInstance().getPlan(fftLength, fftPlanType::kRealForward);
+	plan_backward = FFTPlanRegistry::getInstance().getPlan(fftLength, fftPlanType::kRealInverse);
+
+	fdlReal = arena.allocate<double>(numPartitions * numBins);
+	fdlImag = arena.allocate<double>(numPartitions * numBins);
+	irReal = arena.allocate<double>(numPartitions * numBins);
+	irImag = arena.allocate<double>(numPartitions * numBins);
+	accReal = arena.allocate<double>(numBins);
+	accImag = arena.allocate<double>(numBins);
+	results = arena.allocate<double>(partitionLength * 2);
+
+	reset();
+}
+
+/**
+\brief destroys the FFTW plans and all buffers; any pending job is finished first
+*/
+void ConvolutionStage::destroyFFTW()
+{
+	if (results)
+		finishJob();
+
+	// --- the plans belong to the FFTPlanRegistry
+	plan_forward = nullptr;
+	plan_backward = nullptr;
+
+	// --- every buffer lives in the arena
+	arena.release();
+	inputFrame = nullptr; jobFrame = nullptr; ifftOutput = nullptr;
+	spectrum = nullptr; accumulator = nullptr;
+	fdlReal = nullptr; fdlImag = nullptr; irReal = nullptr; irImag = nullptr;
+	accReal = nullptr; accImag = nullptr; results = nullptr;
+}
+
+/**
+\brief load the segment taps as partition spectra (scaled by 1/fftLength); allocation-free
+
+- the stage is held in kUpdating for the whole update: the worker has no job to claim and endOfBlock( ) skips
+  its blocks instead of queueing them, so no job reads the spectra (or uses jobFrame) while they are rewritten
+
+\param taps the first tap of the segment
+\param count number of taps available (may be shorter than the segment)
+*/
+void ConvolutionStage::setSegment(const double* taps, unsigned int count)
+{
+	if (!results)
+		return;
+
+	// --- finish the pending job, then take the job slot before the audio thread can queue another
+	int claimed = kIdle;
+	while (true)
+	{
+		finishJob();
+		claimed = jobState.load(std::memory_order_acquire);
+		if ((claimed == kIdle || claimed == kDone) &&
+			jobState.compare_exchange_strong(claimed, kUpdating, std::memory_order_acq_rel))
+			break;
+		std::this_thread::yield();
+	}
+
+	const double scale = 1.0 / fftLength;
+	for (unsigned int p = 0; p < numPartitions; p++)
+	{
+		unsigned int start = p * partitionLength;
+		memset(jobFrame, 0, sizeof(double) * fftLength);
+		for (unsigned int i = 0; i < partitionLength && start + i < count; i++)
+			jobFrame[i] = taps[start + i];
+
+		fftw_execute_dft_r2c(plan_forward, jobFrame, spectrum);
+
+		double* re = &irReal[p * numBins];
+		double* im = &irImag[p * numBins];
+		for (unsigned int k = 0; k < numBins; k++)
+		{
+			re[k] = spectrum[k][0] * scale;
+			im[k] = spectrum[k][1] * scale;
+		}
+	}
+
+	jobState.store(claimed, std::memory_order_release);
+}
+
+/**
+\brief flush the input frame, delay line and both result blocks
+*/
+void ConvolutionStage::reset()
+{
+	if (!results)
+		return;
+
+	finishJob();
+	jobState.store(kIdle, std::memory_order_relaxed);
+
+	memset(inputFrame, 0, sizeof(double) * fftLength);
+	memset(fdlReal, 0, sizeof(double) * numPartitions * numBins);
+	memset(fdlImag, 0, sizeof(double) * numPartitions * numBins);
+	memset(results, 0, sizeof(double) * partitionLength * 2);
+
+	blockIndex = 0;
+	readSlot = 0;
+	jobSlot = 0;
+	fdlIndex = 0;
+	skippedBlocks = 0;
+	jobSkippedBlocks = 0;
+}
+
+/**
+\brief worker side: claim and run the job if it is queued
+*/
+void ConvolutionStage::runJobIfQueued()
+{
+	int expected = kQueued;
+	if (jobState.compare_exchange_strong(expected, kRunning, std::memory_order_acq_rel))
+	{
+		runJob();
+		jobState.store(kDone, std::memory_order_release);
+	}
+}
+
+/**
+\brief make sure the last queued job has finished: run it here if the worker has not claimed it, otherwise
+wait for the worker; the wait is unbounded, so the audio callback uses retireJob( ) instead
+*/
+void ConvolutionStage::finishJob()
+{
+	runJobIfQueued();
+	while (jobState.load(std::memory_order_acquire) == kRunning)
+		std::this_thread::yield();
+}
+
+/**
+\brief audio side of finishJob( ): run the job here if the worker has not claimed it, otherwise wait for the
+worker, but for no longer than FAST_CONVOLVER_MAX_WAIT_USEC
+
+\return true if the job is done, false if the worker is still running it
+*/
+bool ConvolutionStage::retireJob()
+{
+	runJobIfQueued();
+	if (jobState.load(std::memory_order_acquire) != kRunning)
+		return true;
+
+	const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(FAST_CONVOLVER_MAX_WAIT_USEC);
+	while (jobState.load(std::memory_order_acquire) == kRunning)
+	{
+		if (std::chrono::steady_clock::now() >= deadline)
+			return false;
+	}
+	return true;
+}
+
+/**
+\brief block boundary: job k - 1 must be done before block k + 1 reads its result, then job k is queued; if the
+worker missed the deadline this block is an xrun (see the class notes); while setSegment( ) is loading new spectra
+the block is skipped the same way, but not counted
+*/
+void ConvolutionStage::endOfBlock()
+{
+	if (!retireJob())
+	{
+		// --- xrun: keep reading the previous result and skip job k; the worker still owns jobFrame
+		xrunCount.store(xrunCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		skippedBlocks++;
+		memcpy(inputFrame, inputFrame + partitionLength, sizeof(double) * partitionLength);
+		return;
+	}
+
+	// --- claim jobFrame for the snapshot; this only fails while setSegment( ) holds the stage
+	int expected = jobState.load(std::memory_order_acquire);
+	if (expected == kUpdating || !jobState.compare_exchange_strong(expected, kPreparing, std::memory_order_acq_rel))
+	{
+		skippedBlocks++;
+		memcpy(inputFrame, inputFrame + partitionLength, sizeof(double) * partitionLength);
+		return;
+	}
+
+	// --- the next block reads the result of job k - 1
+	readSlot ^= 1;
+
+	// --- snapshot [previous | current] for job k and slide the frame
+	memcpy(jobFrame, inputFrame, sizeof(double) * fftLength);
+	memcpy(inputFrame, inputFrame + partitionLength, sizeof(double) * partitionLength);
+
+	// --- job k writes the slot that the block just finished was reading
+	jobSlot = readSlot ^ 1;
+	jobSkippedBlocks = skippedBlocks;
+	skippedBlocks = 0;
+	jobState.store(kQueued, std::memory_order_release);
+
+	if (workerSignal)
+		workerSignal->signal();
+	else
+		runJobIfQueued();
+}
+
+/**
+\brief r2c of the snapshot, push into the delay line, multiply-accumulate all partitions and c2r into the job slot
+*/
+void ConvolutionStage::runJob()
+{
+	fftw_execute_dft_r2c(plan_forward, jobFrame, spectrum);
+
+	// --- blocks skipped after an xrun enter the delay line as silence so the partitions stay aligned
+	for (unsigned int i = 0; i < jobSkippedBlocks && i < numPartitions; i++)
+	{
+		fdlIndex = fdlIndex == 0 ? numPartitions - 1 : fdlIndex - 1;
+		memset(&fdlReal[fdlIndex * numBins], 0, sizeof(double) * numBins);
+		memset(&fdlImag[fdlIndex * numBins], 0, sizeof(double) * numBins);
+	}
+
+	fdlIndex = fdlIndex == 0 ? numPartitions - 1 : fdlIndex - 1;
+	double* newestReal = &fdlReal[fdlIndex * numBins];
+	double* newestImag = &fdlImag[fdlIndex * numBins];
+	for (unsigned int k = 0; k < numBins; k++)
+	{
+		newestReal[k] = spectrum[k][0];
+		newestImag[k] = spectrum[k][1];
+	}
+
+	memset(accReal, 0, sizeof(double) * numBins);
+	memset(accImag, 0, sizeof(double) * numBins);
+
+	for (unsigned int p = 0; p < numPartitions; p++)
+	{
+		unsigned int slot = fdlIndex + p;
+		if (slot >= numPartitions)
+			slot -= numPartitions;
+
+		complexMultiplyAccumulate(&fdlReal[slot * numBins], &fdlImag[slot * numBins],
+								  &irReal[p * numBins], &irImag[p * numBins], accReal, accImag, numBins);
+	}
+
+	for (unsigned int k = 0; k < numBins; k++)
+	{
+		accumulator[k][0] = accReal[k];
+		accumulator[k][1] = accImag[k];
+	}
+
+	fftw_execute_dft_c2r(plan_backward, accumulator, ifftOutput);
+
+	memcpy(&results[jobSlot * partitionLength], ifftOutput + partitionLength, sizeof(double) * partitionLength);
+}
+
+/**
+\brief lay out the head stage and the longer stages for the IR length and allocate everything; not real-time safe
+
+\param _filterImpulseLength the filter IR length
+*/
+void FastConvolver::initialize(unsigned int _filterImpulseLength)
+{
+	// --- same layout unless the length or the background processing setting changed
+	if (filterImpulseLength == _filterImpulseLength && layoutBackgroundProcessing == backgroundProcessing)
+		return;
+
+	stopWorker();
+	filterImpulseLength = _filterImpulseLength;
+	layoutBackgroundProcessing = backgroundProcessing;
+
+	// --- head stage covers [0, 2 x B1)
+	unsigned int partitionLength = FAST_CONVOLVER_HEAD_LEN * FAST_CONVOLVER_GROWTH;
+	headLength = filterImpulseLength < 2 * partitionLength ? filterImpulseLength : 2 * partitionLength;
+	headStage.initialize(FAST_CONVOLVER_HEAD_LEN, headLength);
+
+	// --- stage s covers [2 x B(s), 2 x B(s + 1)); the last one takes the rest
+	numStages = 0;
+	bool threaded = false;
+	while (numStages < FAST_CONVOLVER_MAX_STAGES && 2 * partitionLength < filterImpulseLength)
+	{
+		unsigned int start = 2 * partitionLength;
+		unsigned int end = filterImpulseLength;
+		if (numStages < FAST_CONVOLVER_MAX_STAGES - 1 && 2 * partitionLength * FAST_CONVOLVER_GROWTH < filterImpulseLength)
+			end = 2 * partitionLength * FAST_CONVOLVER_GROWTH;
+
+		bool useWorker = backgroundProcessing && partitionLength >= FAST_CONVOLVER_THREAD_MIN_LEN;
+		threaded |= useWorker;
+
+		stageOffset[numStages] = start;
+		stages[numStages].initialize(partitionLength, (end - start + partitionLength - 1) / partitionLength, useWorker ? &workerSignal : nullptr);
+
+		numStages++;
+		partitionLength *= FAST_CONVOLVER_GROWTH;
+	}
+
+	if (threaded)
+		startWorker();
+}
+
+/**
+\brief load the filter IR into the stages; allocation-free
+
+\param irBuffer the IR, exactly filterImpulseLength long
+*/
+void FastConvolver::setFilterIR(double* irBuffer)
+{
+	if (!irBuffer || filterImpulseLength == 0)
+		return;
+
+	headStage.setImpulseResponse(irBuffer, headLength);
+
+	for (unsigned int s = 0; s < numStages; s++)
+		stages[s].setSegment(&irBuffer[stageOffset[s]], filterImpulseLength - stageOffset[s]);
+}
+
+/**
+\brief flush all stages; the IR is kept
+*/
+void FastConvolver::reset()
+{
+	headStage.reset();
+	for (unsigned int s = 0; s < numStages; s++)
+		stages[s].reset();
+}
+
+/**
+\brief start the worker thread that runs the queued jobs of the long stages
+*/
+void FastConvolver::startWorker()
+{
+	quitWorker.store(false);
+	worker = std::thread([this]()
+	{
+		while (true)
+		{
+			workerSignal.wait();
+			if (quitWorker.load(std::memory_order_acquire))
+				return;
+
+			// --- threaded stages only; the inline stages run their jobs on the audio thread
+			//     longest stages last; the short ones have the nearest deadlines
+			for (unsigned int s = 0; s < numStages; s++)
+			{
+				if (stages[s].usesWorker())
+					stages[s].runJobIfQueued();
+			}
+		}
+	});
+}
+
+/**
+\brief stop and join the worker thread; pending jobs are finished on the calling thread
+*/
+void FastConvolver::stopWorker()
+{
+	if (worker.joinable())
+	{
+		quitWorker.store(true, std::memory_order_release);
+		workerSignal.signal();
+		worker.join();
+	}
+
+	for (unsigned int s = 0; s < numStages; s++)
+		stages[s].finishJob();
+}
+
 /**
 \brief destroys the FFTW arrays and plans.
 */
 void FastFFT::destroyFFTW()
 {
 #ifdef HAVE_FFTW
-	if (plan_forward)
-		fftw_destroy_plan(plan_forward);
-	if (plan_backward)
-		fftw_destroy_plan(plan_backward);
-
-	if (fft_input)
-		fftw_free(fft_input);
-	if (fft_result)
-		fftw_free(fft_result);
-
-	if (ifft_input)
-		fftw_free(ifft_input);
-	if (ifft_result)
-		fftw_free(ifft_result);
+	// --- the plans belong to the FFTPlanRegistry
+	plan_forward = nullptr;
+	plan_backward = nullptr;
+	plan_r2c = nullptr;
+	plan_c2r = nullptr;
+
+	// --- the window and the transform buffers all live in the arena
+	arena.release();
+	windowBuffer = nullptr;
+	fft_input = nullptr; fft_result = nullptr;
+	ifft_input = nullptr; ifft_result = nullptr;
+	real_input = nullptr; real_output = nullptr;
 #endif
 }
 
@@ -1062,12 +1834,19 @@ void FastFFT::initialize(unsigned int _frameLength, windowType _window)
 	window = _window;
 	windowGainCorrection = 0.0;
 
-	if (windowBuffer)
-		delete windowBuffer;
+	// --- one zeroed arena block for the window and the transform buffers; its alignment satisfies FFTW
+	arena.prepare(3 * AudioArena::getAllocationSize<double>(frameLength) +
+				  4 * AudioArena::getAllocationSize<fftw_complex>(frameLength));
+	windowBuffer = arena.allocate<double>(frameLength);
+
+	fft_input = arena.allocate<fftw_complex>(frameLength);
+	fft_result = arena.allocate<fftw_complex>(frameLength);
 
-	windowBuffer = new double[frameLength];
-	memset(&windowBuffer[0], 0, frameLength * sizeof(double));
+	ifft_input = arena.allocate<fftw_complex>(frameLength);
+	ifft_result = arena.allocate<fftw_complex>(frameLength);
 
+	real_input = arena.allocate<double>(frameLength);
+	real_output = arena.allocate<double>(frameLength);
 
 	// --- this is from Reiss & McPherson's code
 	//     https://code.soundsoftware.ac.uk/projects/audio_effects_textbook_code/repository/entry/effects/pvoc_passthrough/Source/PluginProcessor.cpp
@@ -1129,15 +1908,12 @@ void FastFFT::initialize(unsigned int _frameLength, windowType _window)
 	// --- calculate gain correction factor
 	windowGainCorrection = 1.0 / windowGainCorrection;
 
-	destroyFFTW();
-	fft_input = (fftw_complex*)fftw_malloc(sizeof(fftw_complex) * frameLength);
-	fft_result = (fftw_complex*)fftw_malloc(sizeof(fftw_complex) * frameLength);
-
-	ifft_input =  (fftw_complex*)fftw_malloc(sizeof(fftw_complex) * frameLength);
-	ifft_result = (fftw_complex*)fftw_malloc(sizeof(fftw_complex) * frameLength);
-
-	plan_forward = fftw_plan_dft_1d(frameLength, fft_input, fft_result, FFTW_FORWARD, FFTW_ESTIMATE);
-	plan_backward = fftw_plan_dft_1d(frameLength, ifft_input, ifft_result, FFTW_BACKWARD, FFTW_ESTIMATE);
+	// --- shared plans; only the first object of this length pays for planning
+	FFTPlanRegistry& registry = FFTPlanRegistry::getInstance();
+	plan_forward = registry.getPlan(frameLength, fftPlanType::kComplexForward);
+	plan_backward = registry.getPlan(frameLength, fftPlanType::kComplexInverse);
+	plan_r2c = registry.getPlan(frameLength, fftPlanType::kRealForward);
+	plan_c2r = registry.getPlan(frameLength, fftPlanType::kRealInverse);
 }
 
 /**
@@ -1152,18 +1928,27 @@ void FastFFT::initialize(unsigned int _frameLength, windowType _window)
 */
 fftw_complex* FastFFT::doFFT(double* inputReal, double* inputImag)
 {
+	// --- real-valued audio: r2c, then fill the upper half from the conjugate symmetry
+	if (!inputImag)
+	{
+		doRealFFT(inputReal);
+		for (unsigned int k = 1; k < frameLength / 2; k++)
+		{
+			fft_result[frameLength - k][0] = fft_result[k][0];
+			fft_result[frameLength - k][1] = -fft_result[k][1];
+		}
+		return fft_result;
+	}
+
 	// ------ load up the FFT input array
 	for (int i = 0; i < frameLength; i++)
 	{
 		fft_input[i][0] = inputReal[i];		// --- real
-		if (inputImag)
-			fft_input[i][1] = inputImag[i]; // --- imag
-		else
-			fft_input[i][1] = 0.0;
+		fft_input[i][1] = inputImag[i];		// --- imag
 	}
 
 	// --- do the FFT
-	fftw_execute(plan_forward);
+	fftw_execute_dft(plan_forward, fft_input, fft_result);
 
 	return fft_result;
 }
@@ -1191,27 +1976,65 @@ fftw_complex* FastFFT::doInverseFFT(double* inputReal, double* inputImag)
 	}
 
 	// --- do the IFFT
-	fftw_execute(plan_backward);
+	fftw_execute_dft(plan_backward, ifft_input, ifft_result);
 
 	return ifft_result;
 }
 
+/**
+\brief perform the FFT of a real frame with the r2c transform
+
+- NOTES:<br>
+Only the getNumBins( ) = N/2 + 1 non-redundant bins are computed; the rest are their complex conjugates.<br>
+
+\param input an array of frameLength real valued points
+
+\returns a pointer to a fftw_complex array of getNumBins( ) bins
+*/
+fftw_complex* FastFFT::doRealFFT(const double* input)
+{
+	memcpy(real_input, input, sizeof(double) * frameLength);
+	fftw_execute_dft_r2c(plan_r2c, real_input, fft_result);
+
+	return fft_result;
+}
+
+/**
+\brief perform the IFFT of a real signal's spectrum with the c2r transform
+
+- NOTES:<br>
+The output is unnormalized (scaled by N), the same as doInverseFFT( ).<br>
+
+\param spectrum getNumBins( ) bins; not modified
+
+\returns a pointer to frameLength real valued points
+*/
+double* FastFFT::doRealInverseFFT(const fftw_complex* spectrum)
+{
+	// --- c2r overwrites its input, so work on a copy
+	memcpy(ifft_input, spectrum, sizeof(fftw_complex) * getNumBins());
+	fftw_execute_dft_c2r(plan_c2r, ifft_input, real_output);
+
+	return real_output;
+}
+
 /**
 \brief destroys the FFTW arrays and plans.
 */
 void PhaseVocoder::destroyFFTW()
 {
-	if (plan_forward)
-		fftw_destroy_plan(plan_forward);
-	if (plan_backward)
-		fftw_destroy_plan(plan_backward);
-
-	if (fft_input)
-		fftw_free(fft_input);
-	if (fft_result)
-		fftw_free(fft_result);
-	if (ifft_result)
-		fftw_free(ifft_result);
+	// --- the plans belong to the FFTPlanRegistry
+	plan_forward = nullptr;
+	plan_backward = nullptr;
+
+	// --- the timelines, window and transform buffers all live in the arena
+	arena.release();
+	inputBuffer = nullptr;
+	outputBuffer = nullptr;
+	windowBuffer = nullptr;
+	fft_input = nullptr;
+	fft_result = nullptr;
+	ifft_result = nullptr;
 }
 
 /**
@@ -1240,18 +2063,15 @@ void PhaseVocoder::initialize(unsigned int _frameLength, unsigned int _hopSize,
 
 	// --- SETUP BUFFERS ---- //
 	//     NOTE: input and output buffers are circular, others are linear
-	//
-	// --- input buffer, for processing the x(n) timeline
-	if (inputBuffer)
-		delete inputBuffer;
+	//     all of them (and the FFTW buffers) are zeroed blocks of one arena
+	arena.prepare(4 * AudioArena::getAllocationSize<double>(frameLength) +
+				  AudioArena::getAllocationSize<double>(frameLength * 4) +
+				  AudioArena::getAllocationSize<fftw_complex>(getNumBins()));
 
-	inputBuffer = new double[frameLength];
-	memset(&inputBuffer[0], 0, frameLength * sizeof(double));
+	// --- input buffer, for processing the x(n) timeline
+	inputBuffer = arena.allocate<double>(frameLength);
 
 	// --- output buffer, for processing the y(n) timeline and accumulating frames
-	if (outputBuffer)
-		delete outputBuffer;
-
 	// --- the output buffer is declared as 2x the normal frame size
 	//     to accomodate time-stretching/pitch shifting; you can increase the size
 	//     here; if so make sure to calculate the wrapMaskOut properly and everything
@@ -1259,16 +2079,11 @@ void PhaseVocoder::initialize(unsigned int _frameLength, unsigned int _hopSize,
 	//     (not sure why you would do this - and it will surely affect CPU performance)
 	//     NOTE: the length of the buffer is only to accomodate accumulations
 	//           it does not stretch time or change causality on its own
-	outputBuffer = new double[frameLength * 4];
-	memset(&outputBuffer[0], 0, (frameLength*4.0) * sizeof(double));
+	outputBuffer = arena.allocate<double>(frameLength * 4);
 	wrapMaskOut = (frameLength*4.0) - 1;
 
 	// --- fixed window buffer
-	if (windowBuffer)
-		delete windowBuffer;
-
-	windowBuffer = new double[frameLength];
-	memset(&windowBuffer[0], 0, frameLength * sizeof(double));
+	windowBuffer = arena.allocate<double>(frameLength);
 
 	// --- this is from Reiss & McPherson's code
 	//     https://code.soundsoftware.ac.uk/projects/audio_effects_textbook_code/repository/entry/effects/pvoc_passthrough/Source/PluginProcessor.cpp
@@ -1347,13 +2162,13 @@ void PhaseVocoder::initialize(unsigned int _frameLength, unsigned int _hopSize,
 	needOverlapAdd = false;
 
 #ifdef HAVE_FFTW
-	destroyFFTW();
-	fft_input = (fftw_complex*)fftw_malloc(sizeof(fftw_complex) * frameLength);
-	fft_result = (fftw_complex*)fftw_malloc(sizeof(fftw_complex) * frameLength);
-	ifft_result = (fftw_complex*)fftw_malloc(sizeof(fftw_complex) * frameLength);
+	fft_input = arena.allocate<double>(frameLength);
+	fft_result = arena.allocate<fftw_complex>(getNumBins());
+	ifft_result = arena.allocate<double>(frameLength);
 
-	plan_forward = fftw_plan_dft_1d(frameLength, fft_input, fft_result, FFTW_FORWARD, FFTW_ESTIMATE);
-	plan_backward = fftw_plan_dft_1d(frameLength, fft_result, ifft_result, FFTW_BACKWARD, FFTW_ESTIMATE);
+	// --- shared plans; only the first vocoder of this length pays for planning
+	plan_forward = FFTPlanRegistry::getInstance().getPlan(frameLength, fftPlanType::kRealForward);
+	plan_backward = FFTPlanRegistry::getInstance().getPlan(frameLength, fftPlanType::kRealInverse);
 #endif
 }
 
@@ -1408,15 +2223,14 @@ bool PhaseVocoder::advanceAndCheckFFT()
 	// --- load up the input to the FFT
 	for (int i = 0; i < frameLength; i++)
 	{
-		fft_input[i][0] = inputBuffer[inputReadIndex++] * windowBuffer[i];
-		fft_input[i][1] = 0.0; // use this if your data is complex valued
+		fft_input[i] = inputBuffer[inputReadIndex++] * windowBuffer[i];
 
 		// --- wrap if index > bufferlength - 1
 		inputReadIndex &= wrapMask;
 	}
 
 	// --- do the FFT
-	fftw_execute(plan_forward);
+	fftw_execute_dft_r2c(plan_forward, fft_input, fft_result);
 
 	// --- in case user does not take IFFT, just to prevent zero output
 	needInverseFFT = true;
@@ -1492,8 +2306,8 @@ then you can call this function at the appropriate time - see the PSMVocoder obj
 */
 void PhaseVocoder::doInverseFFT()
 {
-	// do the IFFT
-	fftw_execute(plan_backward);
+	// do the IFFT; c2r overwrites the spectrum, which is not needed afterwards
+	fftw_execute_dft_c2r(plan_backward, fft_result, ifft_result);
 
 	// --- output is now in ifft_result array
 	needInverseFFT = false;
@@ -1532,7 +2346,7 @@ void PhaseVocoder::doOverlapAdd(double* outputData, int length)
 	for (int i = 0; i < frameLength; i++)
 	{
 		// --- accumulate
-		outputBuffer[outputWriteIndex++] += windowHopCorrection * ifft_result[i][0];
+		outputBuffer[outputWriteIndex++] += windowHopCorrection * ifft_result[i];
 
 		// --- wrap if index > bufferlength - 1
 		outputWriteIndex &= wrapMaskOut;
@@ -19,8 +19,10 @@
 
 #include <memory>
 #include <math.h>
+#include <map>
+#include <mutex>
+#include <vector>
 #include "guiconstants.h"
-#include "filters.h"
 #include <time.h>       /* time */
 
 /** @file fxobjects.h
@@ -70,6 +72,30 @@ inline bool checkFloatUnderflow(double& value)
 	return retValue;
 }
 
+// --- per-sample underflow checks in the filter/detector loops; the denormal guard in
+//     PluginBase::processAudioBuffers( ) flushes denormals in hardware so these are off by default
+#ifndef FXOBJECTS_UNDERFLOW_CHECKS
+#define FXOBJECTS_UNDERFLOW_CHECKS 0
+#endif
+
+/**
+@hotPathUnderflowCheck
+\ingroup FX-Functions
+
+@brief Underflow check for per-sample loops; calls checkFloatUnderflow( ) only when FXOBJECTS_UNDERFLOW_CHECKS is 1,
+otherwise compiles to nothing and relies on the FTZ/DAZ mode set by ScopedDenormalGuard
+
+\param value - the value to check for underflow
+*/
+inline void hotPathUnderflowCheck(double& value)
+{
+#if FXOBJECTS_UNDERFLOW_CHECKS
+	checkFloatUnderflow(value);
+#else
+	(void)value;
+#endif
+}
+
 /**
 @doLinearInterpolation
 \ingroup FX-Functions
@@ -165,6 +191,22 @@ inline void boundValue(double& value, double minValue, double maxValue)
 	value = fmax(value, minValue);
 }
 
+/**
+@fastTan
+\ingroup FX-Functions
+
+@brief Rational (Pade 7/6) approximation of tan(x) for filter prewarping; one division, no trig call.
+Relative error is below 1e-13 up to x = 0.7 and below 2e-8 up to x = 1.5 (fc = 0.476 * fs)
+
+\param x - angle in radians on [0, pi/2)
+\return approximation of tan(x)
+*/
+inline double fastTan(double x)
+{
+	const double x2 = x*x;
+	return x*(135135.0 - x2*(17325.0 - x2*(378.0 - x2))) / (135135.0 - x2*(62370.0 - x2*(3150.0 - 28.0*x2)));
+}
+
 /**
 @doUnipolarModulationFromMin
 \ingroup FX-Functions
@@ -456,6 +498,36 @@ inline double getMagResponse(double theta, double a0, double a1, double a2, doub
 	return mag;
 }
 
+/**
+@getMagResponse
+\ingroup FX-Functions
+
+@brief batch version of getMagResponse( ) for a grid of frequencies; the cos(theta) terms are
+precomputed by the caller and the loop has no branches so that it vectorizes
+\param cosTheta - cos(theta) for each grid point
+\param count - number of grid points
+\param a0, a1, a2, b1, b2 - the transfer function coefficients
+\param mag - output: the magnitude response at each grid point
+*/
+inline void getMagResponse(const double* cosTheta, uint32_t count, double a0, double a1, double a2, double b1, double b2, double* mag)
+{
+	// --- numerator and denominator as polynomials in cos(theta)
+	const double numK = a1*a1 + (a0 - a2)*(a0 - a2);
+	const double numL = 2.0*a1*(a0 + a2);
+	const double numQ = 4.0*a0*a2;
+	const double denK = b1*b1 + (1.0 - b2)*(1.0 - b2);
+	const double denL = 2.0*b1*(1.0 + b2);
+	const double denQ = 4.0*b2;
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		const double c = cosTheta[i];
+		const double num = numK + (numL + numQ*c)*c;
+		const double denom = denK + (denL + denQ*c)*c;
+		mag[i] = sqrt(fmax(num / denom, 0.0));
+	}
+}
+
 /**
 \struct ComplexNumber
 \ingroup FX-Objects
@@ -1039,6 +1111,63 @@ inline double principalArg(double phaseIn)
 		return fmod(phaseIn + kPi, -kTwoPi) + kPi;
 }
 
+/**
+@wrapPhase
+\ingroup FX-Functions
+
+@brief branch-free principal argument on [-pi, +pi); same result as principalArg( ) but without fmod( ),
+so loops over it vectorize
+
+\param phaseIn - value to convert
+\return the wrapped value
+*/
+inline double wrapPhase(double phaseIn)
+{
+	return phaseIn - kTwoPi * floor((phaseIn + kPi) * (1.0 / kTwoPi));
+}
+
+/**
+@getMagnitudesAndPhases
+\ingroup FX-Functions
+
+@brief converts an interleaved (re, im) spectrum into separate magnitude and phase arrays
+
+\param spectrum - interleaved complex bins, e.g. &fftw_complex[0][0]
+\param magnitude - output magnitudes
+\param phase - output phases
+\param count - number of bins
+*/
+inline void getMagnitudesAndPhases(const double* spectrum, double* magnitude, double* phase, unsigned int count)
+{
+	for (unsigned int k = 0; k < count; k++)
+	{
+		const double re = spectrum[2 * k];
+		const double im = spectrum[2 * k + 1];
+		magnitude[k] = sqrt(re*re + im*im);
+		phase[k] = atan2(im, re);
+	}
+}
+
+/**
+@setMagnitudesAndPhases
+\ingroup FX-Functions
+
+@brief converts separate magnitude and phase arrays back into an interleaved (re, im) spectrum
+
+\param spectrum - interleaved complex bins, e.g. &fftw_complex[0][0]
+\param magnitude - magnitudes
+\param phase - phases
+\param count - number of bins
+*/
+inline void setMagnitudesAndPhases(double* spectrum, const double* magnitude, const double* phase, unsigned int count)
+{
+	for (unsigned int k = 0; k < count; k++)
+	{
+		spectrum[2 * k] = magnitude[k] * cos(phase[k]);
+		spectrum[2 * k + 1] = magnitude[k] * sin(phase[k]);
+	}
+}
+
 enum class interpolation {kLinear, kLagrange4};
 
 /**
@@ -1171,6 +1300,14 @@ public:
 	/** process one sample in and out */
 	virtual double processAudioSample(double xn) = 0;
 
+	/** process a mono block; one virtual call per block, so composites can chain whole buffers.
+	    The default runs processAudioSample( ); objects with a faster block path override it. in and out may be the same buffer */
+	virtual void processAudioBlock(const double* input, double* output, uint32_t numSamples)
+	{
+		for (uint32_t i = 0; i < numSamples; i++)
+			output[i] = processAudioSample(input[i]);
+	}
+
 	/** return true if the derived object can process a frame, false otherwise */
 	virtual bool canProcessAudioFrame() = 0;
 
@@ -1353,6 +1490,186 @@ struct BiquadParameters
 	biquadAlgorithm biquadCalcType = biquadAlgorithm::kDirect; ///< biquad structure to use
 };
 
+/**
+\struct BiquadKernel
+\ingroup FX-Objects
+\brief
+Branch-free biquad kernels, one specialization per biquadAlgorithm topology.
+
+Each kernel operates on a coefficient array (indexed with filterCoeff) and a state array (indexed with stateReg)
+owned by the caller:
+- processSample( ) runs one sample and updates the state array
+- processBlock( ) loads the coefficients and z^-1 registers into locals, runs the whole block and writes the
+  registers back once; output is dry*x(n) + wet*y(n) so AudioFilter can fold its c0/d0 mix into the same loop
+- getStorage( ) returns the S (storage) value for Harma filters from the current state; it is computed on
+  demand rather than on every sample, and is only non-zero for the direct and transposed canonical forms
+
+in and out may point to the same buffer.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 18
+*/
+template <biquadAlgorithm topology>
+struct BiquadKernel;
+
+/** direct form: y(n) = a0*x(n) + a1*x(n-1) + a2*x(n-2) - b1*y(n-1) - b2*y(n-2) */
+template <>
+struct BiquadKernel<biquadAlgorithm::kDirect>
+{
+	static inline double processSample(const double* coeffs, double* states, double xn)
+	{
+		double yn = coeffs[a0] * xn + (coeffs[a1] * states[x_z1] + coeffs[a2] * states[x_z2] -
+									   coeffs[b1] * states[y_z1] - coeffs[b2] * states[y_z2]);
+		hotPathUnderflowCheck(yn);
+
+		states[x_z2] = states[x_z1];
+		states[x_z1] = xn;
+		states[y_z2] = states[y_z1];
+		states[y_z1] = yn;
+		return yn;
+	}
+
+	static inline void processBlock(const double* coeffs, double* states, const double* in, double* out, uint32_t count, double wet = 1.0, double dry = 0.0)
+	{
+		const double ca0 = coeffs[a0], ca1 = coeffs[a1], ca2 = coeffs[a2], cb1 = coeffs[b1], cb2 = coeffs[b2];
+		double xz1 = states[x_z1], xz2 = states[x_z2], yz1 = states[y_z1], yz2 = states[y_z2];
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const double xn = in[i];
+			double yn = ca0 * xn + (ca1 * xz1 + ca2 * xz2 - cb1 * yz1 - cb2 * yz2);
+			hotPathUnderflowCheck(yn);
+
+			xz2 = xz1; xz1 = xn;
+			yz2 = yz1; yz1 = yn;
+			out[i] = dry * xn + wet * yn;
+		}
+
+		states[x_z1] = xz1; states[x_z2] = xz2; states[y_z1] = yz1; states[y_z2] = yz2;
+	}
+
+	static inline double getStorage(const double* coeffs, const double* states)
+	{
+		return coeffs[a1] * states[x_z1] + coeffs[a2] * states[x_z2] - coeffs[b1] * states[y_z1] - coeffs[b2] * states[y_z2];
+	}
+};
+
+/** canonical form: w(n) = x(n) - b1*w(n-1) - b2*w(n-2); y(n) = a0*w(n) + a1*w(n-1) + a2*w(n-2) */
+template <>
+struct BiquadKernel<biquadAlgorithm::kCanonical>
+{
+	static inline double processSample(const double* coeffs, double* states, double xn)
+	{
+		double wn = xn - coeffs[b1] * states[x_z1] - coeffs[b2] * states[x_z2];
+		double yn = coeffs[a0] * wn + coeffs[a1] * states[x_z1] + coeffs[a2] * states[x_z2];
+		hotPathUnderflowCheck(yn);
+
+		states[x_z2] = states[x_z1];
+		states[x_z1] = wn;
+		return yn;
+	}
+
+	static inline void processBlock(const double* coeffs, double* states, const double* in, double* out, uint32_t count, double wet = 1.0, double dry = 0.0)
+	{
+		const double ca0 = coeffs[a0], ca1 = coeffs[a1], ca2 = coeffs[a2], cb1 = coeffs[b1], cb2 = coeffs[b2];
+		double z1 = states[x_z1], z2 = states[x_z2];
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const double xn = in[i];
+			double wn = xn - cb1 * z1 - cb2 * z2;
+			double yn = ca0 * wn + ca1 * z1 + ca2 * z2;
+			hotPathUnderflowCheck(yn);
+
+			z2 = z1; z1 = wn;
+			out[i] = dry * xn + wet * yn;
+		}
+
+		states[x_z1] = z1; states[x_z2] = z2;
+	}
+
+	static inline double getStorage(const double*, const double*) { return 0.0; }
+};
+
+/** transposed direct form: w(n) = x(n) + y-state; y(n) = a0*w(n) + x-state */
+template <>
+struct BiquadKernel<biquadAlgorithm::kTransposeDirect>
+{
+	static inline double processSample(const double* coeffs, double* states, double xn)
+	{
+		double wn = xn + states[y_z1];
+		double yn = coeffs[a0] * wn + states[x_z1];
+		hotPathUnderflowCheck(yn);
+
+		states[y_z1] = states[y_z2] - coeffs[b1] * wn;
+		states[y_z2] = -coeffs[b2] * wn;
+		states[x_z1] = states[x_z2] + coeffs[a1] * wn;
+		states[x_z2] = coeffs[a2] * wn;
+		return yn;
+	}
+
+	static inline void processBlock(const double* coeffs, double* states, const double* in, double* out, uint32_t count, double wet = 1.0, double dry = 0.0)
+	{
+		const double ca0 = coeffs[a0], ca1 = coeffs[a1], ca2 = coeffs[a2], cb1 = coeffs[b1], cb2 = coeffs[b2];
+		double xz1 = states[x_z1], xz2 = states[x_z2], yz1 = states[y_z1], yz2 = states[y_z2];
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const double xn = in[i];
+			double wn = xn + yz1;
+			double yn = ca0 * wn + xz1;
+			hotPathUnderflowCheck(yn);
+
+			yz1 = yz2 - cb1 * wn;
+			yz2 = -cb2 * wn;
+			xz1 = xz2 + ca1 * wn;
+			xz2 = ca2 * wn;
+			out[i] = dry * xn + wet * yn;
+		}
+
+		states[x_z1] = xz1; states[x_z2] = xz2; states[y_z1] = yz1; states[y_z2] = yz2;
+	}
+
+	static inline double getStorage(const double*, const double*) { return 0.0; }
+};
+
+/** transposed canonical form: y(n) = a0*x(n) + s1; s1 = a1*x(n) - b1*y(n) + s2; s2 = a2*x(n) - b2*y(n) */
+template <>
+struct BiquadKernel<biquadAlgorithm::kTransposeCanonical>
+{
+	static inline double processSample(const double* coeffs, double* states, double xn)
+	{
+		double yn = coeffs[a0] * xn + states[x_z1];
+		hotPathUnderflowCheck(yn);
+
+		states[x_z1] = coeffs[a1] * xn - coeffs[b1] * yn + states[x_z2];
+		states[x_z2] = coeffs[a2] * xn - coeffs[b2] * yn;
+		return yn;
+	}
+
+	static inline void processBlock(const double* coeffs, double* states, const double* in, double* out, uint32_t count, double wet = 1.0, double dry = 0.0)
+	{
+		const double ca0 = coeffs[a0], ca1 = coeffs[a1], ca2 = coeffs[a2], cb1 = coeffs[b1], cb2 = coeffs[b2];
+		double s1 = states[x_z1], s2 = states[x_z2];
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const double xn = in[i];
+			double yn = ca0 * xn + s1;
+			hotPathUnderflowCheck(yn);
+
+			s1 = ca1 * xn - cb1 * yn + s2;
+			s2 = ca2 * xn - cb2 * yn;
+			out[i] = dry * xn + wet * yn;
+		}
+
+		states[x_z1] = s1; states[x_z2] = s2;
+	}
+
+	static inline double getStorage(const double*, const double* states) { return states[x_z1]; }
+};
+
 /**
 \class Biquad
 \ingroup FX-Objects
@@ -1395,6 +1712,14 @@ public:
 	*/
 	virtual double processAudioSample(double xn);
 
+	/** process a block through the biquad; the calculation type is resolved once per block, in and out may be the same buffer */
+	/**
+	\param in input buffer
+	\param out output buffer
+	\param count number of samples
+	*/
+	virtual void processAudioBlock(const double* in, double* out, uint32_t count);
+
 	/** get parameters: note use of custom structure for passing param data */
 	/**
 	\return BiquadParameters custom data structure
@@ -1432,7 +1757,7 @@ public:
 	double getG_value() { return coeffArray[a0]; }
 
 	/** get the structure S (storage) value for Harma filters; see 2nd Ed FX book */
-	double getS_value() { return storageComponent; }
+	double getS_value();
 
 protected:
 	/** array of coefficients */
@@ -1443,123 +1768,373 @@ protected:
 
 	/** type of calculation (algorithm  structure) */
 	BiquadParameters parameters;
-
-	/** for Harma loop resolution */
-	double storageComponent = 0.0;
 };
 
-
 /**
-\enum filterAlgorithm
-\ingroup Constants-Enums
+\class TopologyBiquad
+\ingroup FX-Objects
 \brief
-Use this strongly typed enum to easily set the filter algorithm for the AudioFilter object or any other object that requires filter definitions.
+The TopologyBiquad object is a Biquad whose structure is fixed at compile time with the topology template
+argument, so the per-sample code is a single branch-free BiquadKernel with no calculation-type switch.
 
-- filterAlgorithm { kLPF1P, kLPF1, kHPF1, kLPF2, kHPF2, kBPF2, kBSF2, kButterLPF2, kButterHPF2, kButterBPF2, kButterBSF2, kMMALPF2, kMMALPF2B, kLowShelf, kHiShelf, kNCQParaEQ, kCQParaEQ, kLWRLPF2, kLWRHPF2, kAPF1, kAPF2, kResonA, kResonB, kMatchLP2A, kMatchLP2B, kMatchBP2A, kMatchBP2B, kImpInvLP1, kImpInvLP2 };
+Audio I/O:
+- Processes mono input to mono output.
+- processAudioBlock( ) processes a whole buffer with the z^-1 registers held in locals.
 
-\author Will Pirkle http://www.willpirkle.com
-\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+Control I/F:
+- none; the structure is the template argument, coefficients are set with setCoefficients( )
+
+\author Christian George
 \version Revision : 1.0
-\date Date : 2018 / 09 / 7
+\date Date : 2026 / 10 / 18
 */
-enum class filterAlgorithm {
-	kLPF1P, kLPF1, kHPF1, kLPF2, kHPF2, kBPF2, kBSF2, kButterLPF2, kButterHPF2, kButterBPF2,
-	kButterBSF2, kMMALPF2, kMMALPF2B, kLowShelf, kHiShelf, kNCQParaEQ, kCQParaEQ, kLWRLPF2, kLWRHPF2,
-	kAPF1, kAPF2, kResonA, kResonB, kMatchLP2A, kMatchLP2B, kMatchBP2A, kMatchBP2B,
-	kImpInvLP1, kImpInvLP2
-}; // --- you will add more here...
+template <biquadAlgorithm topology>
+class TopologyBiquad : public IAudioSignalProcessor
+{
+public:
+	TopologyBiquad() {}		/* C-TOR */
+	~TopologyBiquad() {}	/* D-TOR */
 
+	/** reset: clear out the state array (flush delays) */
+	virtual bool reset(double)
+	{
+		memset(&stateArray[0], 0, sizeof(double)*numStates);
+		return true;
+	}
 
-/**
-\struct AudioFilterParameters
-\ingroup FX-Objects
-\brief
-Custom parameter structure for the AudioFilter object.
+	/** return false: this object only processes samples */
+	virtual bool canProcessAudioFrame() { return false; }
 
-\author Will Pirkle http://www.willpirkle.com
-\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
-\version Revision : 1.0
-\date Date : 2018 / 09 / 7
-*/
-struct AudioFilterParameters
-{
-	AudioFilterParameters(){}
-	/** all FXObjects parameter objects require overloaded= operator so remember to add new entries if you add new variables. */
-	AudioFilterParameters& operator=(const AudioFilterParameters& params)	// need this override for collections to work
+	/** process input x(n) through biquad to produce return value y(n) */
+	virtual double processAudioSample(double xn)
 	{
-		if (this == &params)
-			return *this;
-		algorithm = params.algorithm;
-		fc = params.fc;
-		Q = params.Q;
-		boostCut_dB = params.boostCut_dB;
+		return BiquadKernel<topology>::processSample(&coeffArray[0], &stateArray[0], xn);
+	}
 
-		return *this;
+	/** process a block, in and out may be the same buffer */
+	virtual void processAudioBlock(const double* in, double* out, uint32_t count)
+	{
+		BiquadKernel<topology>::processBlock(&coeffArray[0], &stateArray[0], in, out, count);
 	}
 
-	// --- individual parameters
-	filterAlgorithm algorithm = filterAlgorithm::kLPF1; ///< filter algorithm
-	double fc = 100.0; ///< filter cutoff or center frequency (Hz)
-	double Q = 0.707; ///< filter Q
-	double boostCut_dB = 0.0; ///< filter gain; note not used in all types
+	/** process a block; output is dry*x(n) + wet*y(n), in and out may be the same buffer */
+	void processAudioBlock(const double* in, double* out, uint32_t count, double wet, double dry)
+	{
+		BiquadKernel<topology>::processBlock(&coeffArray[0], &stateArray[0], in, out, count, wet, dry);
+	}
+
+	/** set the coefficient array */
+	void setCoefficients(double* coeffs) { memcpy(&coeffArray[0], &coeffs[0], sizeof(double)*numCoeffs); }
+
+	/** get the coefficient array */
+	double* getCoefficients() { return &coeffArray[0]; }
+
+	/** get the state array */
+	double* getStateArray() { return &stateArray[0]; }
+
+	/** get the structure G (gain) value for Harma filters; see 2nd Ed FX book */
+	double getG_value() { return coeffArray[a0]; }
+
+	/** get the structure S (storage) value for Harma filters; see 2nd Ed FX book */
+	double getS_value() { return BiquadKernel<topology>::getStorage(&coeffArray[0], &stateArray[0]); }
+
+protected:
+	/** array of coefficients */
+	double coeffArray[numCoeffs] = { 0.0 };
+
+	/** array of state (z^-1) registers */
+	double stateArray[numStates] = { 0.0 };
 };
 
 /**
-\class AudioFilter
+\class BiquadCascade
 \ingroup FX-Objects
 \brief
-The AudioFilter object implements all filters in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+The BiquadCascade object runs numSections second-order sections in series on numLanes independent lanes
+(channels, or parallel filters fed the same input) using the transposed canonical structure.
+
+Coefficients and z^-1 registers are stored lane-contiguous ([section][coefficient][lane]) so the inner loops
+run across lanes with a compile-time trip count; the compiler vectorizes them without platform intrinsics.
 
 Audio I/O:
-- Processes mono input to mono output.
+- processAudioFrame( ) processes one sample on every lane through all sections.
+- processAudioBlock( ) processes one buffer per lane; the registers are held in locals for the whole block.
+- in and out may alias in both functions.
 
 Control I/F:
-- Use AudioFilterParameters structure to get/set object params.
+- setSectionCoefficients( ) swaps the coefficients of one section on one lane (or all lanes); the array is indexed
+  with filterCoeff and the AudioFilter c0/d0 wet/dry mix is folded into the section numerator.
+- sections start as pass-through (a0 = 1).
 
-\author Will Pirkle http://www.willpirkle.com
-\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\author Christian George
 \version Revision : 1.0
-\date Date : 2018 / 09 / 7
+\date Date : 2026 / 10 / 18
 */
-class AudioFilter : public IAudioSignalProcessor
+template <uint32_t numSections, uint32_t numLanes>
+class BiquadCascade
 {
 public:
-	AudioFilter() {}		/* C-TOR */
-	~AudioFilter() {}		/* D-TOR */
-
-	// --- IAudioSignalProcessor
-	/** --- set sample rate, then update coeffs */
-	virtual bool reset(double _sampleRate)
+	BiquadCascade()		/* C-TOR */
 	{
-		BiquadParameters bqp = biquad.getParameters();
-		bqp.biquadCalcType = biquadAlgorithm::kTransposeCanonical;
-
-		sampleRate = _sampleRate;
-		return biquad.reset(_sampleRate);
+		for (uint32_t s = 0; s < numSections; s++)
+			setSectionPassThrough(s);
 	}
+	~BiquadCascade() {}	/* D-TOR */
 
-	/** return false: this object only processes samples */
-	virtual bool canProcessAudioFrame() { return false; }
+	/** flush the z^-1 registers */
+	void reset()
+	{
+		memset(&states[0][0][0], 0, sizeof(states));
+	}
 
-	/** process input x(n) through the filter to produce return value y(n) */
+	/** swap the coefficients for one section on one lane */
 	/**
-	\param xn input
-	\return the processed sample
+	\param section section index (0 = first in series)
+	\param lane lane index
+	\param coeffs coefficient array indexed with filterCoeff (a0 ... d0), e.g. from AudioFilter::getCoefficients( )
+	\param gain extra scalar applied to the section output (e.g. -1.0 to invert)
 	*/
-	virtual double processAudioSample(double xn);
-
-	/** --- sample rate change necessarily requires recalculation */
-	virtual void setSampleRate(double _sampleRate)
+	void setSectionCoefficients(uint32_t section, uint32_t lane, const double* coeffs, double gain = 1.0)
 	{
-		sampleRate = _sampleRate;
-		calculateFilterCoeffs();
-	}
+		// --- d0*x(n) + c0*H(z)x(n) is a biquad with the same poles: fold the mix into the numerator
+		const double wet = coeffs[c0] * gain;
+		const double dry = coeffs[d0] * gain;
 
-	/** --- get parameters */
-	AudioFilterParameters getParameters() { return audioFilterParameters; }
+		sectionCoeffs[section][sosA0][lane] = wet * coeffs[a0] + dry;
+		sectionCoeffs[section][sosA1][lane] = wet * coeffs[a1] + dry * coeffs[b1];
+		sectionCoeffs[section][sosA2][lane] = wet * coeffs[a2] + dry * coeffs[b2];
+		sectionCoeffs[section][sosB1][lane] = coeffs[b1];
+		sectionCoeffs[section][sosB2][lane] = coeffs[b2];
+	}
 
-	/** --- set parameters */
-	void setParameters(const AudioFilterParameters& parameters)
+	/** swap the coefficients for one section on all lanes */
+	void setSectionCoefficients(uint32_t section, const double* coeffs, double gain = 1.0)
+	{
+		for (uint32_t l = 0; l < numLanes; l++)
+			setSectionCoefficients(section, l, coeffs, gain);
+	}
+
+	/** set a section to pass-through on all lanes */
+	void setSectionPassThrough(uint32_t section)
+	{
+		for (uint32_t l = 0; l < numLanes; l++)
+		{
+			sectionCoeffs[section][sosA0][l] = 1.0;
+			sectionCoeffs[section][sosA1][l] = 0.0;
+			sectionCoeffs[section][sosA2][l] = 0.0;
+			sectionCoeffs[section][sosB1][l] = 0.0;
+			sectionCoeffs[section][sosB2][l] = 0.0;
+		}
+	}
+
+	/** process one sample per lane through all sections */
+	/**
+	\param in numLanes input samples
+	\param out numLanes output samples
+	*/
+	void processAudioFrame(const double* in, double* out)
+	{
+		double x[numLanes];
+		for (uint32_t l = 0; l < numLanes; l++)
+			x[l] = in[l];
+
+		for (uint32_t s = 0; s < numSections; s++)
+		{
+			const double* ca0 = sectionCoeffs[s][sosA0]; const double* ca1 = sectionCoeffs[s][sosA1];
+			const double* ca2 = sectionCoeffs[s][sosA2]; const double* cb1 = sectionCoeffs[s][sosB1];
+			const double* cb2 = sectionCoeffs[s][sosB2];
+			double* s1 = states[s][0];
+			double* s2 = states[s][1];
+
+			for (uint32_t l = 0; l < numLanes; l++)
+			{
+				double yn = ca0[l] * x[l] + s1[l];
+				hotPathUnderflowCheck(yn);
+				s1[l] = ca1[l] * x[l] - cb1[l] * yn + s2[l];
+				s2[l] = ca2[l] * x[l] - cb2[l] * yn;
+				x[l] = yn;
+			}
+		}
+
+		for (uint32_t l = 0; l < numLanes; l++)
+			out[l] = x[l];
+	}
+
+	/** process one buffer per lane through all sections */
+	/**
+	\param in numLanes input buffers
+	\param out numLanes output buffers
+	\param count number of samples in each buffer
+	*/
+	void processAudioBlock(const double* const* in, double* const* out, uint32_t count)
+	{
+		double s1[numSections][numLanes];
+		double s2[numSections][numLanes];
+		for (uint32_t s = 0; s < numSections; s++)
+		{
+			memcpy(&s1[s][0], &states[s][0][0], sizeof(double)*numLanes);
+			memcpy(&s2[s][0], &states[s][1][0], sizeof(double)*numLanes);
+		}
+
+		for (uint32_t n = 0; n < count; n++)
+		{
+			double x[numLanes];
+			for (uint32_t l = 0; l < numLanes; l++)
+				x[l] = in[l][n];
+
+			for (uint32_t s = 0; s < numSections; s++)
+			{
+				for (uint32_t l = 0; l < numLanes; l++)
+				{
+					double yn = sectionCoeffs[s][sosA0][l] * x[l] + s1[s][l];
+					hotPathUnderflowCheck(yn);
+					s1[s][l] = sectionCoeffs[s][sosA1][l] * x[l] - sectionCoeffs[s][sosB1][l] * yn + s2[s][l];
+					s2[s][l] = sectionCoeffs[s][sosA2][l] * x[l] - sectionCoeffs[s][sosB2][l] * yn;
+					x[l] = yn;
+				}
+			}
+
+			for (uint32_t l = 0; l < numLanes; l++)
+				out[l][n] = x[l];
+		}
+
+		for (uint32_t s = 0; s < numSections; s++)
+		{
+			memcpy(&states[s][0][0], &s1[s][0], sizeof(double)*numLanes);
+			memcpy(&states[s][1][0], &s2[s][0], sizeof(double)*numLanes);
+		}
+	}
+
+protected:
+	enum { sosA0, sosA1, sosA2, sosB1, sosB2, numSOSCoeffs };
+
+	double sectionCoeffs[numSections][numSOSCoeffs][numLanes];	///< lane-contiguous coefficients
+	double states[numSections][2][numLanes] = {};					///< lane-contiguous transposed canonical registers
+};
+
+
+
+
+/**
+\enum filterAlgorithm
+\ingroup Constants-Enums
+\brief
+Use this strongly typed enum to easily set the filter algorithm for the AudioFilter object or any other object that requires filter definitions.
+
+- filterAlgorithm { kLPF1P, kLPF1, kHPF1, kLPF2, kHPF2, kBPF2, kBSF2, kButterLPF2, kButterHPF2, kButterBPF2, kButterBSF2, kMMALPF2, kMMALPF2B, kLowShelf, kHiShelf, kNCQParaEQ, kCQParaEQ, kLWRLPF2, kLWRHPF2, kAPF1, kAPF2, kResonA, kResonB, kMatchLP2A, kMatchLP2B, kMatchBP2A, kMatchBP2B, kImpInvLP1, kImpInvLP2 };
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+enum class filterAlgorithm {
+	kLPF1P, kLPF1, kHPF1, kLPF2, kHPF2, kBPF2, kBSF2, kButterLPF2, kButterHPF2, kButterBPF2,
+	kButterBSF2, kMMALPF2, kMMALPF2B, kLowShelf, kHiShelf, kNCQParaEQ, kCQParaEQ, kLWRLPF2, kLWRHPF2,
+	kAPF1, kAPF2, kResonA, kResonB, kMatchLP2A, kMatchLP2B, kMatchBP2A, kMatchBP2B,
+	kImpInvLP1, kImpInvLP2
+}; // --- you will add more here...
+
+
+/**
+\struct AudioFilterParameters
+\ingroup FX-Objects
+\brief
+Custom parameter structure for the AudioFilter object.
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+struct AudioFilterParameters
+{
+	AudioFilterParameters(){}
+	/** all FXObjects parameter objects require overloaded= operator so remember to add new entries if you add new variables. */
+	AudioFilterParameters& operator=(const AudioFilterParameters& params)	// need this override for collections to work
+	{
+		if (this == &params)
+			return *this;
+		algorithm = params.algorithm;
+		fc = params.fc;
+		Q = params.Q;
+		boostCut_dB = params.boostCut_dB;
+
+		return *this;
+	}
+
+	// --- individual parameters
+	filterAlgorithm algorithm = filterAlgorithm::kLPF1; ///< filter algorithm
+	double fc = 100.0; ///< filter cutoff or center frequency (Hz)
+	double Q = 0.707; ///< filter Q
+	double boostCut_dB = 0.0; ///< filter gain; note not used in all types
+};
+
+/**
+\class AudioFilter
+\ingroup FX-Objects
+\brief
+The AudioFilter object implements all filters in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+
+Audio I/O:
+- Processes mono input to mono output.
+
+Control I/F:
+- Use AudioFilterParameters structure to get/set object params.
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+class AudioFilter : public IAudioSignalProcessor
+{
+public:
+	AudioFilter() {}		/* C-TOR */
+	~AudioFilter() {}		/* D-TOR */
+
+	// --- IAudioSignalProcessor
+	/** --- set sample rate, then update coeffs */
+	virtual bool reset(double _sampleRate)
+	{
+		sampleRate = _sampleRate;
+		return biquad.reset(_sampleRate);
+	}
+
+	/** return false: this object only processes samples */
+	virtual bool canProcessAudioFrame() { return false; }
+
+	/** process input x(n) through the filter to produce return value y(n) */
+	/**
+	\param xn input
+	\return the processed sample
+	*/
+	virtual double processAudioSample(double xn);
+
+	/** process a block through the filter; in and out may be the same buffer */
+	/**
+	\param in input buffer
+	\param out output buffer
+	\param count number of samples
+	*/
+	virtual void processAudioBlock(const double* in, double* out, uint32_t count)
+	{
+		// --- (dry) + (processed) folded into the kernel loop: x(n)*d0 + y(n)*c0
+		biquad.processAudioBlock(in, out, count, coeffArray[c0], coeffArray[d0]);
+	}
+
+	/** --- sample rate change necessarily requires recalculation */
+	virtual void setSampleRate(double _sampleRate)
+	{
+		sampleRate = _sampleRate;
+		calculateFilterCoeffs();
+	}
+
+	/** --- get parameters */
+	AudioFilterParameters getParameters() { return audioFilterParameters; }
+
+	/** --- set parameters */
+	void setParameters(const AudioFilterParameters& parameters)
 	{
 		if (audioFilterParameters.algorithm != parameters.algorithm ||
 			audioFilterParameters.boostCut_dB != parameters.boostCut_dB ||
@@ -1586,9 +2161,12 @@ public:
 	/** --- helper for Harma filters (phaser) */
 	double getS_value() { return biquad.getS_value(); }
 
+	/** --- get the current coefficients, indexed with filterCoeff (a0 ... d0) */
+	const double* getCoefficients() { return &coeffArray[0]; }
+
 protected:
-	// --- our calculator
-	Biquad biquad; ///< the biquad object
+	// --- our calculator; direct form, fixed at compile time
+	TopologyBiquad<biquadAlgorithm::kDirect> biquad; ///< the biquad object
 
 	// --- array to hold coeffs (we need them too)
 	double coeffArray[numCoeffs] = { 0.0 }; ///< our local copy of biquad coeffs
@@ -1642,6 +2220,7 @@ split frequencies to support more bands.
 struct LRFilterBankParameters
 {
 	LRFilterBankParameters() {}
+	LRFilterBankParameters(const LRFilterBankParameters& params) = default;
 	/** all FXObjects parameter objects require overloaded= operator so remember to add new entries if you add new variables. */
 	LRFilterBankParameters& operator=(const LRFilterBankParameters& params)	// need this override for collections to work
 	{
@@ -1665,6 +2244,7 @@ Note that one channel is inverted (see the FX book below for explanation). You c
 
 Audio I/O:
 - Processes mono input into a custom FilterBankOutput structure.
+- the two filters run as the two lanes of a BiquadCascade; the AudioFilter members only calculate coefficients
 NOTE: processAudioSample( ) is inoperable and only returns the input back.
 
 Control I/F:
@@ -1688,6 +2268,8 @@ public:
 		params = hpFilter.getParameters();
 		params.algorithm = filterAlgorithm::kLWRHPF2;
 		hpFilter.setParameters(params);
+
+		loadSplitterCoefficients();
 	}
 
 	~LRFilterBank() {}	/* D-TOR */
@@ -1697,6 +2279,13 @@ public:
 	{
 		lpFilter.reset(_sampleRate);
 		hpFilter.reset(_sampleRate);
+
+		// --- reset() does not recalculate; a new rate with the same split would keep stale coefficients
+		lpFilter.setSampleRate(_sampleRate);
+		hpFilter.setSampleRate(_sampleRate);
+
+		splitter.reset();
+		loadSplitterCoefficients();
 		return true;
 	}
 
@@ -1718,16 +2307,34 @@ public:
 	{
 		FilterBankOutput output;
 
-		// --- process the LPF
-		output.LFOut = lpFilter.processAudioSample(xn);
+		// --- lane 0 = LPF, lane 1 = HPF; the HP inversion (for correct phase
+		//     and magnitude on recombination) is folded into its coefficients
+		double input[2] = { xn, xn };
+		double bands[2];
+		splitter.processAudioFrame(input, bands);
 
-		// --- invert the HP filter output so that recombination will
-		//     result in the correct phase and magnitude responses
-		output.HFOut = -hpFilter.processAudioSample(xn);
+		output.LFOut = bands[0];
+		output.HFOut = bands[1];
 
 		return output;
 	}
 
+	/** this does nothing for this object (the input is copied), see processFilterBankBlock( ) below */
+	virtual void processAudioBlock(const double* input, double* output, uint32_t numSamples)
+	{
+		if (output != input)
+			memcpy(output, input, sizeof(double)*numSamples);
+	}
+
+	/** split a block into LF and HF bands in one pass of the splitter; same result as numSamples calls to
+	    processFilterBank( ). Either band may be the input buffer */
+	void processFilterBankBlock(const double* input, double* lfOutput, double* hfOutput, uint32_t numSamples)
+	{
+		const double* in[2] = { input, input };
+		double* out[2] = { lfOutput, hfOutput };
+		splitter.processAudioBlock(in, out, numSamples);
+	}
+
 	/** get parameters: note use of custom structure for passing param data */
 	/**
 	\return LRFilterBankParameters custom data structure
@@ -1754,115 +2361,316 @@ public:
 		params = hpFilter.getParameters();
 		params.fc = parameters.splitFrequency;
 		hpFilter.setParameters(params);
+
+		loadSplitterCoefficients();
+	}
+
+	/** magnitude responses of the two bands over a frequency grid; see the batch getMagResponse( ) */
+	/**
+	\param cosTheta cos(theta) for each grid point
+	\param count number of grid points
+	\param lfMag output: LF band magnitude
+	\param hfMag output: HF band magnitude (the inversion does not change the magnitude)
+	*/
+	void getMagResponse(const double* cosTheta, uint32_t count, double* lfMag, double* hfMag)
+	{
+		// --- the LR filters have c0 = 1 and d0 = 0, so this is the biquad alone
+		const double* lp = lpFilter.getCoefficients();
+		const double* hp = hpFilter.getCoefficients();
+		::getMagResponse(cosTheta, count, lp[a0], lp[a1], lp[a2], lp[b1], lp[b2], lfMag);
+		::getMagResponse(cosTheta, count, hp[a0], hp[a1], hp[a2], hp[b1], hp[b2], hfMag);
 	}
 
 protected:
-	AudioFilter lpFilter; ///< low-band filter
-	AudioFilter hpFilter; ///< high-band filter
+	AudioFilter lpFilter; ///< low-band filter (coefficient calculation)
+	AudioFilter hpFilter; ///< high-band filter (coefficient calculation)
+	BiquadCascade<1, 2> splitter; ///< lane 0 = LPF, lane 1 = inverted HPF
+
+	/** copy the designed coefficients into the splitter lanes */
+	void loadSplitterCoefficients()
+	{
+		splitter.setSectionCoefficients(0, 0, lpFilter.getCoefficients());
+		splitter.setSectionCoefficients(0, 1, hpFilter.getCoefficients(), -1.0);
+	}
 
 	// --- object parameters
 	LRFilterBankParameters parameters; ///< parameters for the object
 };
 
-// --- constants
-const unsigned int TLD_AUDIO_DETECT_MODE_PEAK = 0;
-const unsigned int TLD_AUDIO_DETECT_MODE_MS = 1;
-const unsigned int TLD_AUDIO_DETECT_MODE_RMS = 2;
-const double TLD_AUDIO_ENVELOPE_ANALOG_TC = -0.99967234081320612357829304641019; // ln(36.7%)
-
 /**
-\struct AudioDetectorParameters
+\struct TPTCrossoverParameters
 \ingroup FX-Objects
 \brief
-Custom parameter structure for the AudioDetector object. NOTE: this object uses constant defintions:
-
-- const unsigned int TLD_AUDIO_DETECT_MODE_PEAK = 0;
-- const unsigned int TLD_AUDIO_DETECT_MODE_MS = 1;
-- const unsigned int TLD_AUDIO_DETECT_MODE_RMS = 2;
-- const double TLD_AUDIO_ENVELOPE_ANALOG_TC = -0.99967234081320612357829304641019; // ln(36.7%)
+Custom parameter structure for the TPTCrossover object.
 
-\author Will Pirkle http://www.willpirkle.com
-\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\author Christian George
 \version Revision : 1.0
-\date Date : 2018 / 09 / 7
+\date Date : 2026 / 10 / 18
 */
-struct AudioDetectorParameters
+struct TPTCrossoverParameters
 {
-	AudioDetectorParameters() {}
+	TPTCrossoverParameters() {}
+	TPTCrossoverParameters(const TPTCrossoverParameters& params) = default;
 	/** all FXObjects parameter objects require overloaded= operator so remember to add new entries if you add new variables. */
-	AudioDetectorParameters& operator=(const AudioDetectorParameters& params)	// need this override for collections to work
+	TPTCrossoverParameters& operator=(const TPTCrossoverParameters& params)	// need this override for collections to work
 	{
 		if (this == &params)
 			return *this;
-		attackTime_mSec = params.attackTime_mSec;
-		releaseTime_mSec = params.releaseTime_mSec;
-		detectMode = params.detectMode;
-		detect_dB = params.detect_dB;
-		clampToUnityMax = params.clampToUnityMax;
+		splitFrequency = params.splitFrequency;
+		smoothingTime_mSec = params.smoothingTime_mSec;
 		return *this;
 	}
 
 	// --- individual parameters
-	double attackTime_mSec = 0.0; ///< attack time in milliseconds
-	double releaseTime_mSec = 0.0;///< release time in milliseconds
-	unsigned int  detectMode = 0;///< detect mode, see TLD_ constants above
-	bool detect_dB = false;	///< detect in dB  DEFAULT  = false (linear NOT log)
-	bool clampToUnityMax = true;///< clamp output to 1.0 (set false for true log detectors)
+	double splitFrequency = 1000.0;		///< LF/HF split frequency
+	double smoothingTime_mSec = 5.0;	///< time constant for split frequency changes; 0 = jump
 };
 
 /**
-\class AudioDetector
+\class TPTCrossover
 \ingroup FX-Objects
 \brief
-The AudioDetector object implements the audio detector defined in the book source below.
-NOTE: this detector can receive signals and transmit detection values that are both > 0dBFS
+The TPTCrossover object is a modulation-safe drop-in for LRFilterBank: a 2nd order Linkwitz-Riley split built from
+the ZVAFilter state variable (TPT) structure with R = 1 (Q = 0.5), so one filter produces both bands.
+
+- LF = SVF LP, HF = -SVF HP; LF + HF is the same first order allpass as LRFilterBank and the magnitude
+  responses match its kLWRLPF2/kLWRHPF2 filters
+- the split frequency is smoothed per sample (one-pole, in Hz) and the coefficients are recalculated with fastTan( ),
+  so automation and morphs move the split without zipper noise; the TPT structure keeps its state valid while the
+  coefficients change
 
 Audio I/O:
-- Processes mono input to a detected signal output.
+- Processes mono input into a custom FilterBankOutput structure.
+NOTE: processAudioSample( ) is inoperable and only returns the input back.
 
 Control I/F:
-- Use AudioDetectorParameters structure to get/set object params.
+- Use TPTCrossoverParameters structure to get/set object params.
 
-\author Will Pirkle http://www.willpirkle.com
-\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\author Christian George
 \version Revision : 1.0
-\date Date : 2018 / 09 / 7
+\date Date : 2026 / 10 / 18
 */
-class AudioDetector : public IAudioSignalProcessor
+class TPTCrossover : public IAudioSignalProcessor
 {
 public:
-	AudioDetector() {}	/* C-TOR */
-	~AudioDetector() {}	/* D-TOR */
+	TPTCrossover()		/* C-TOR */
+	{
+		calculateSmoothingCoeff();
+		calculateFilterCoeffs();
+	}
+	~TPTCrossover() {}	/* D-TOR */
 
-public:
-	/** set sample rate dependent time constants and clear last envelope output value */
+	/** reset: flush the integrators and jump to the target split frequency */
 	virtual bool reset(double _sampleRate)
 	{
-		setSampleRate(_sampleRate);
-		lastEnvelope = 0.0;
+		sampleRate = _sampleRate;
+		integrator_z[0] = 0.0;
+		integrator_z[1] = 0.0;
+
+		calculateSmoothingCoeff();
+		currentFc = parameters.splitFrequency;
+		calculateFilterCoeffs();
 		return true;
 	}
 
 	/** return false: this object only processes samples */
 	virtual bool canProcessAudioFrame() { return false; }
 
-	// --- process audio: detect the log envelope and return it in dB
-	/**
-	\param xn input
-	\return the processed sample
-	*/
+	/** this does nothing for this object, see processFilterBank( ) below */
 	virtual double processAudioSample(double xn)
 	{
-		// --- all modes do Full Wave Rectification
-		double input = fabs(xn);
+		return xn;
+	}
 
-		// --- square it for MS and RMS
-		if (audioDetectorParameters.detectMode == TLD_AUDIO_DETECT_MODE_MS ||
-			audioDetectorParameters.detectMode == TLD_AUDIO_DETECT_MODE_RMS)
-			input *= input;
+	/** process the filter bank */
+	FilterBankOutput processFilterBank(double xn)
+	{
+		// --- glide towards the target split; snap when inaudibly close
+		if (currentFc != parameters.splitFrequency)
+		{
+			currentFc = parameters.splitFrequency + smoothingCoeff*(currentFc - parameters.splitFrequency);
+			if (fabs(currentFc - parameters.splitFrequency) < 0.01)
+				currentFc = parameters.splitFrequency;
+			calculateFilterCoeffs();
+		}
 
-		// --- to store current
-		double currEnvelope = 0.0;
+		// --- ZVAFilter SVF with R = 1
+		double hpf = alpha0*(xn - rho*integrator_z[0] - integrator_z[1]);
+		double bpf = alpha*hpf + integrator_z[0];
+		double lpf = alpha*bpf + integrator_z[1];
+
+		integrator_z[0] = alpha*hpf + bpf;
+		integrator_z[1] = alpha*bpf + lpf;
+
+		FilterBankOutput output;
+		output.LFOut = lpf;
+		output.HFOut = -hpf; // --- inverted, as in LRFilterBank
+		return output;
+	}
+
+	/** get parameters: note use of custom structure for passing param data */
+	/**
+	\return TPTCrossoverParameters custom data structure
+	*/
+	TPTCrossoverParameters getParameters() { return parameters; }
+
+	/** set parameters: the split frequency becomes the new smoothing target */
+	/**
+	\param TPTCrossoverParameters custom data structure
+	*/
+	void setParameters(const TPTCrossoverParameters& _parameters)
+	{
+		bool newSmoothing = _parameters.smoothingTime_mSec != parameters.smoothingTime_mSec;
+		parameters = _parameters;
+
+		if (newSmoothing)
+			calculateSmoothingCoeff();
+
+		if (parameters.smoothingTime_mSec <= 0.0 && currentFc != parameters.splitFrequency)
+		{
+			currentFc = parameters.splitFrequency;
+			calculateFilterCoeffs();
+		}
+	}
+
+	/** the split frequency the filter is currently running at (may lag the parameter while smoothing) */
+	double getCurrentSplitFrequency() { return currentFc; }
+
+protected:
+	TPTCrossoverParameters parameters;	///< object parameters
+	double sampleRate = 44100.0;		///< current sample rate
+	double currentFc = 1000.0;			///< smoothed split frequency
+
+	// --- state storage
+	double integrator_z[2] = { 0.0, 0.0 };	///< state variables
+
+	// --- filter coefficients (see ZVAFilter)
+	double alpha0 = 0.0;		///< input scalar, correct delay-free loop
+	double alpha = 0.0;			///< alpha is g = tan(wcT/2)
+	double rho = 0.0;			///< p = 2R + g (feedback)
+	double smoothingCoeff = 0.0;	///< one-pole coefficient for the split frequency
+
+	/** recalculate g, alpha0 and rho for the current split; R = 1 */
+	void calculateFilterCoeffs()
+	{
+		// --- keep the prewarp argument clear of the tan() pole at Nyquist
+		double fc = fmax(fmin(currentFc, 0.48*sampleRate), 1.0);
+		double g = fastTan(kPi*fc / sampleRate);
+
+		alpha = g;
+		rho = 2.0 + g;
+		alpha0 = 1.0 / (1.0 + g*(2.0 + g));
+	}
+
+	/** one-pole coefficient from the smoothing time constant */
+	void calculateSmoothingCoeff()
+	{
+		if (parameters.smoothingTime_mSec <= 0.0)
+			smoothingCoeff = 0.0;
+		else
+			smoothingCoeff = exp(-1.0 / (parameters.smoothingTime_mSec * 0.001 * sampleRate));
+	}
+};
+
+// --- constants
+const unsigned int TLD_AUDIO_DETECT_MODE_PEAK = 0;
+const unsigned int TLD_AUDIO_DETECT_MODE_MS = 1;
+const unsigned int TLD_AUDIO_DETECT_MODE_RMS = 2;
+const double TLD_AUDIO_ENVELOPE_ANALOG_TC = -0.99967234081320612357829304641019; // ln(36.7%)
+
+/**
+\struct AudioDetectorParameters
+\ingroup FX-Objects
+\brief
+Custom parameter structure for the AudioDetector object. NOTE: this object uses constant defintions:
+
+- const unsigned int TLD_AUDIO_DETECT_MODE_PEAK = 0;
+- const unsigned int TLD_AUDIO_DETECT_MODE_MS = 1;
+- const unsigned int TLD_AUDIO_DETECT_MODE_RMS = 2;
+- const double TLD_AUDIO_ENVELOPE_ANALOG_TC = -0.99967234081320612357829304641019; // ln(36.7%)
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+struct AudioDetectorParameters
+{
+	AudioDetectorParameters() {}
+	/** all FXObjects parameter objects require overloaded= operator so remember to add new entries if you add new variables. */
+	AudioDetectorParameters& operator=(const AudioDetectorParameters& params)	// need this override for collections to work
+	{
+		if (this == &params)
+			return *this;
+		attackTime_mSec = params.attackTime_mSec;
+		releaseTime_mSec = params.releaseTime_mSec;
+		detectMode = params.detectMode;
+		detect_dB = params.detect_dB;
+		clampToUnityMax = params.clampToUnityMax;
+		return *this;
+	}
+
+	// --- individual parameters
+	double attackTime_mSec = 0.0; ///< attack time in milliseconds
+	double releaseTime_mSec = 0.0;///< release time in milliseconds
+	unsigned int  detectMode = 0;///< detect mode, see TLD_ constants above
+	bool detect_dB = false;	///< detect in dB  DEFAULT  = false (linear NOT log)
+	bool clampToUnityMax = true;///< clamp output to 1.0 (set false for true log detectors)
+};
+
+/**
+\class AudioDetector
+\ingroup FX-Objects
+\brief
+The AudioDetector object implements the audio detector defined in the book source below.
+NOTE: this detector can receive signals and transmit detection values that are both > 0dBFS
+
+Audio I/O:
+- Processes mono input to a detected signal output.
+
+Control I/F:
+- Use AudioDetectorParameters structure to get/set object params.
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+class AudioDetector : public IAudioSignalProcessor
+{
+public:
+	AudioDetector() {}	/* C-TOR */
+	~AudioDetector() {}	/* D-TOR */
+
+public:
+	/** set sample rate dependent time constants and clear last envelope output value */
+	virtual bool reset(double _sampleRate)
+	{
+		setSampleRate(_sampleRate);
+		lastEnvelope = 0.0;
+		return true;
+	}
+
+	/** return false: this object only processes samples */
+	virtual bool canProcessAudioFrame() { return false; }
+
+	// --- process audio: detect the log envelope and return it in dB
+	/**
+	\param xn input
+	\return the processed sample
+	*/
+	virtual double processAudioSample(double xn)
+	{
+		// --- all modes do Full Wave Rectification
+		double input = fabs(xn);
+
+		// --- square it for MS and RMS
+		if (audioDetectorParameters.detectMode == TLD_AUDIO_DETECT_MODE_MS ||
+			audioDetectorParameters.detectMode == TLD_AUDIO_DETECT_MODE_RMS)
+			input *= input;
+
+		// --- to store current
+		double currEnvelope = 0.0;
 
 		// --- do the detection with attack or release applied
 		if (input > lastEnvelope)
@@ -1871,7 +2679,7 @@ public:
 			currEnvelope = releaseTime * (lastEnvelope - input) + input;
 
 		// --- we are recursive so need to check underflow
-		checkFloatUnderflow(currEnvelope);
+		hotPathUnderflowCheck(currEnvelope);
 
 		// --- bound them; can happen when using pre-detector gains of more than 1.0
 		if (audioDetectorParameters.clampToUnityMax)
@@ -1901,6 +2709,42 @@ public:
 		return 20.0*log10(currEnvelope);
 	}
 
+	/** detect a block with the mode resolved once and the envelope held in a local; same result as numSamples
+	    calls to processAudioSample( ) (RMS to rounding: sqrt( ) rather than pow( )) */
+	virtual void processAudioBlock(const double* input, double* output, uint32_t numSamples)
+	{
+		const bool squared = audioDetectorParameters.detectMode == TLD_AUDIO_DETECT_MODE_MS ||
+							 audioDetectorParameters.detectMode == TLD_AUDIO_DETECT_MODE_RMS;
+		const bool rms = audioDetectorParameters.detectMode == TLD_AUDIO_DETECT_MODE_RMS;
+		const bool clamp = audioDetectorParameters.clampToUnityMax;
+		const bool dB = audioDetectorParameters.detect_dB;
+		const double attack = attackTime;
+		const double release = releaseTime;
+		double envelope = lastEnvelope;
+
+		for (uint32_t i = 0; i < numSamples; i++)
+		{
+			double xn = fabs(input[i]);
+			if (squared)
+				xn *= xn;
+
+			envelope = (xn > envelope ? attack : release) * (envelope - xn) + xn;
+			hotPathUnderflowCheck(envelope);
+
+			if (clamp)
+				envelope = fmin(envelope, 1.0);
+			envelope = fmax(envelope, 0.0);
+
+			double yn = rms ? sqrt(envelope) : envelope;
+			if (dB)
+				yn = yn <= 0.0 ? -96.0 : 20.0*log10(yn);
+
+			output[i] = yn;
+		}
+
+		lastEnvelope = envelope;
+	}
+
 	/** get parameters: note use of custom structure for passing param data */
 	/**
 	\return AudioDetectorParameters custom data structure
@@ -1971,6 +2815,8 @@ Use this strongly typed enum to set the dynamics processor type.
 // --- processorType
 enum class dynamicsProcessorType { kCompressor, kDownwardExpander };
 
+const unsigned int DYNAMICS_BLOCK_LEN = 64;	///< stack scratch length for the DynamicsProcessor block loop
+
 
 /**
 \struct DynamicsProcessorParameters
@@ -2005,6 +2851,7 @@ struct DynamicsProcessorParameters
 		// --- NOTE: do not set outbound variables??
 		gainReduction = params.gainReduction;
 		gainReduction_dB = params.gainReduction_dB;
+		detect_dB = params.detect_dB;
 		return *this;
 	}
 
@@ -2023,6 +2870,7 @@ struct DynamicsProcessorParameters
 	// --- outbound values, for owner to use gain-reduction metering
 	double gainReduction = 1.0;			///< output value for gain reduction that occurred
 	double gainReduction_dB = 0.0;		///< output value for gain reduction that occurred in dB
+	double detect_dB = -96.0;			///< output value for the most recent detector level in dB
 };
 
 /**
@@ -2106,15 +2954,23 @@ public:
 	*/
 	virtual double processAudioSample(double xn)
 	{
-		// --- detect input
-		double detect_dB = 0.0;
+		// --- detect input, then compute and apply the gain
+		return applyGain(xn, detectLevel(xn));
+	}
 
+	/** first half of processAudioSample( ): run the detector on xn (or the sidechain sample) and return the level in dB */
+	inline double detectLevel(double xn)
+	{
 		// --- if using the sidechain, process the aux input
 		if(parameters.enableSidechain)
-			detect_dB = detector.processAudioSample(sidechainInputSample);
+			return detector.processAudioSample(sidechainInputSample);
 		else
-			detect_dB = detector.processAudioSample(xn);
+			return detector.processAudioSample(xn);
+	}
 
+	/** second half of processAudioSample( ): compute the gain for the detected level and apply it with the makeup gain */
+	inline double applyGain(double xn, double detect_dB)
+	{
 		// --- compute gain
 		double gr = computeGain(detect_dB);
 
@@ -2125,6 +2981,44 @@ public:
 		return xn * gr * makeupGain;
 	}
 
+	/** process a block; same result as numSamples calls to processAudioSample( ). The detector runs as a
+	    block and the makeup gain is calculated once. With the sidechain enabled the stored sidechain
+	    sample is used, as in processAudioSample( ); use processSidechainBlock( ) for a sidechain buffer */
+	virtual void processAudioBlock(const double* input, double* output, uint32_t numSamples)
+	{
+		processDynamicsBlock(input, nullptr, output, numSamples);
+	}
+
+	/** process a block with a sidechain buffer; the sidechain is only used when it is enabled */
+	void processSidechainBlock(const double* input, const double* sidechain, double* output, uint32_t numSamples)
+	{
+		processDynamicsBlock(input, sidechain, output, numSamples);
+	}
+
+	/** evaluate the static transfer curve (including makeup gain) with computeGain( ); the outbound
+	    metering values are left as they were */
+	/**
+	\param input_dB array of input levels in dB
+	\param output_dB output: the output level in dB for each input level
+	\param count number of points
+	*/
+	void computeTransferCurve(const double* input_dB, double* output_dB, uint32_t count)
+	{
+		double gainReduction = parameters.gainReduction;
+		double gainReduction_dB = parameters.gainReduction_dB;
+		double detect_dB = parameters.detect_dB;
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			computeGain(input_dB[i]);
+			output_dB[i] = input_dB[i] + parameters.gainReduction_dB + parameters.outputGain_dB;
+		}
+
+		parameters.gainReduction = gainReduction;
+		parameters.gainReduction_dB = gainReduction_dB;
+		parameters.detect_dB = detect_dB;
+	}
+
 protected:
 	DynamicsProcessorParameters parameters; ///< object parameters
 	AudioDetector detector; ///< the sidechain audio detector
@@ -2132,6 +3026,45 @@ protected:
 	// --- storage for sidechain audio input (mono only)
 	double sidechainInputSample = 0.0; ///< storage for sidechain sample
 
+	/** block core: the detector fills a chunk of levels, then gain and DCA per sample; sidechain may be nullptr */
+	void processDynamicsBlock(const double* input, const double* sidechain, double* output, uint32_t numSamples)
+	{
+		const double makeupGain = pow(10.0, parameters.outputGain_dB / 20.0);
+		double detect_dB[DYNAMICS_BLOCK_LEN];
+		double sidechainChunk[DYNAMICS_BLOCK_LEN];
+
+		uint32_t done = 0;
+		while (done < numSamples)
+		{
+			uint32_t count = numSamples - done;
+			if (count > DYNAMICS_BLOCK_LEN) count = DYNAMICS_BLOCK_LEN;
+
+			// --- detect the chunk first: the detector does not depend on the gain, and output may alias input
+			const double* detectInput = input + done;
+			if (parameters.enableSidechain)
+			{
+				if (sidechain)
+					detectInput = sidechain + done;
+				else
+				{
+					for (uint32_t i = 0; i < count; i++)
+						sidechainChunk[i] = sidechainInputSample;
+					detectInput = sidechainChunk;
+				}
+			}
+			detector.processAudioBlock(detectInput, detect_dB, count);
+
+			for (uint32_t i = 0; i < count; i++)
+				output[done + i] = input[done + i] * computeGain(detect_dB[i]) * makeupGain;
+
+			done += count;
+		}
+
+		// --- carry the last sidechain sample like processAuxInputAudioSample( ) would have
+		if (parameters.enableSidechain && sidechain && numSamples > 0)
+			sidechainInputSample = sidechain[numSamples - 1];
+	}
+
 	/** compute (and save) the current gain value based on detected input (dB) */
 	inline double computeGain(double detect_dB)
 	{
@@ -2209,6 +3142,7 @@ protected:
 		}
 
 		// --- convert gain; store values for user meters
+		parameters.detect_dB = detect_dB;
 		parameters.gainReduction_dB = output_dB - detect_dB;
 		parameters.gainReduction = pow(10.0, (parameters.gainReduction_dB) / 20.0);
 
@@ -2217,70 +3151,244 @@ protected:
 	}
 };
 
+const size_t ARENA_ALIGNMENT = 64;	///< arena block alignment: one cache line, a multiple of every SIMD width and of fftw_malloc( )'s
+
 /**
-\class LinearBuffer
+\class AudioArena
 \ingroup FX-Objects
 \brief
-The LinearBuffer object implements a linear buffer of type T. It allows easy wrapping of a smart pointer object.
+The AudioArena object is a bump allocator for DSP state: one aligned block is allocated when the owner is prepared and
+the owner's objects carve their delay lines, frames and tables out of it.
 
-\author Will Pirkle http://www.willpirkle.com
-\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+- every block is zeroed and starts on an ARENA_ALIGNMENT boundary, so it can go straight to SIMD loops and to FFTW's
+  new-array execute functions
+- the blocks of one owner are contiguous, nothing is freed on its own, and the whole arena is one free on destruction
+- rewind( ) or prepare( ) invalidate everything carved so far; the owner re-carves before touching the old buffers
+- a block that does not fit still comes back (from a separate allocation) and getBytesRequested( ) reports what the
+  arena should have held, so the owner sizes itself by carving once and retrying:
+
+	arena.rewind();
+	carveBuffers();
+	if (arena.hasOverflowed())
+	{
+		arena.prepare(arena.getBytesRequested());
+		carveBuffers();
+	}
+
+- getGeneration( ) changes on every rewind, so a buffer can tell whether its block is still valid and skip re-carving
+
+Control I/F:
+- none; prepare( ), rewind( ) and allocate( ) are not real-time safe: call them from reset( ) or initialization code.
+
+\author Christian George
 \version Revision : 1.0
-\date Date : 2018 / 09 / 7
+\date Date : 2026 / 10 / 19
 */
-template <typename T>
-class LinearBuffer
+class AudioArena
 {
 public:
-	LinearBuffer() {}	/* C-TOR */
-	~LinearBuffer() {}	/* D-TOR */
-
-	/** flush buffer by resetting all values to 0.0 */
-	void flushBuffer() { memset(&buffer[0], 0, bufferLength * sizeof(T)); }
+	AudioArena() {}		/* C-TOR */
+	~AudioArena() {}	/* D-TOR */
 
-	/** Create a buffer based on a target maximum in SAMPLES
-	//	   do NOT call from realtime audio thread; do this prior to any processing */
-	void createLinearBuffer(unsigned int _bufferLength)
+	/** make sure the arena holds at least capacityBytes (grow only) and rewind it */
+	void prepare(size_t capacityBytes)
 	{
-		// --- find nearest power of 2 for buffer, save it as bufferLength
-		bufferLength = _bufferLength;
+		capacityBytes = getAllocationSize<unsigned char>(capacityBytes);
+		if (capacityBytes > capacity)
+		{
+			block.reset(new unsigned char[capacityBytes + ARENA_ALIGNMENT]);
+			base = alignPointer(block.get());
+			capacity = capacityBytes;
+		}
+		rewind();
+	}
 
-		// --- create new buffer
-		buffer.reset(new T[bufferLength]);
+	/** free everything */
+	void release()
+	{
+		block.reset();
+		base = nullptr;
+		capacity = 0;
+		rewind();
+	}
 
-		// --- flush buffer
-		flushBuffer();
+	/** start carving from the top again; all previous blocks are invalid */
+	void rewind()
+	{
+		bytesUsed = 0;
+		bytesRequested = 0;
+		overflowBlocks.clear();
+		generation++;
 	}
 
-	/** write a value into the buffer; this overwrites the previous oldest value in the buffer */
-	void writeBuffer(unsigned int index, T input)
+	/** carve a zeroed, aligned block of count T's (trivial types only); never returns nullptr */
+	template <typename T>
+	T* allocate(size_t count)
 	{
-		if (index >= bufferLength) return;
+		const size_t bytes = getAllocationSize<T>(count);
+		bytesRequested += bytes;
 
-		// --- write and increment index counter
-		buffer[index] = input;
+		unsigned char* memory = nullptr;
+		if (bytesUsed + bytes <= capacity)
+		{
+			memory = base + bytesUsed;
+			bytesUsed += bytes;
+		}
+		else
+		{
+			// --- too small: keep the caller working, the owner re-prepares with getBytesRequested( )
+			overflowBlocks.emplace_back(new unsigned char[bytes + ARENA_ALIGNMENT]);
+			memory = alignPointer(overflowBlocks.back().get());
+		}
+
+		memset(memory, 0, bytes);
+		return reinterpret_cast<T*>(memory);
 	}
 
-	/**  read an arbitrary location that is delayInSamples old */
-	T readBuffer(unsigned int index)//, bool readBeforeWrite = true)
+	/** bytes a block of count T's takes in the arena; sum these to size prepare( ) exactly */
+	template <typename T>
+	static size_t getAllocationSize(size_t count)
 	{
-		if (index >= bufferLength) return 0.0;
-
-		// --- read it
-		return buffer[index];
+		const size_t bytes = count * sizeof(T);
+		return bytes == 0 ? ARENA_ALIGNMENT : (bytes + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1);
 	}
 
+	/** get the size of the arena block in bytes */
+	size_t getCapacity() { return capacity; }
+
+	/** get the bytes carved from the arena block since the last rewind */
+	size_t getBytesUsed() { return bytesUsed; }
+
+	/** get the bytes asked for since the last rewind, including blocks that did not fit */
+	size_t getBytesRequested() { return bytesRequested; }
+
+	/** true if a block since the last rewind did not fit */
+	bool hasOverflowed() { return bytesRequested > capacity; }
+
+	/** get the rewind count; a block carved in an earlier generation is invalid */
+	uint32_t getGeneration() { return generation; }
+
 private:
-	std::unique_ptr<T[]> buffer = nullptr;	///< smart pointer will auto-delete
-	unsigned int bufferLength = 1024; ///< buffer length
-};
+	AudioArena(const AudioArena&) = delete;
+	AudioArena& operator=(const AudioArena&) = delete;
 
+	/** round up to the next ARENA_ALIGNMENT boundary */
+	static unsigned char* alignPointer(unsigned char* pointer)
+	{
+		const size_t offset = (size_t)(ARENA_ALIGNMENT - ((uintptr_t)pointer & (ARENA_ALIGNMENT - 1))) & (ARENA_ALIGNMENT - 1);
+		return pointer + offset;
+	}
+
+	std::unique_ptr<unsigned char[]> block = nullptr;	///< the arena (over-allocated for alignment)
+	unsigned char* base = nullptr;						///< aligned start of the arena
+	size_t capacity = 0;								///< usable bytes from base
+	size_t bytesUsed = 0;								///< bytes carved since the last rewind
+	size_t bytesRequested = 0;							///< bytes asked for since the last rewind
+	uint32_t generation = 1;							///< rewind count (0 = never carved)
+	std::vector<std::unique_ptr<unsigned char[]>> overflowBlocks;	///< blocks that did not fit, freed on rewind
+};
 
 /**
-\class CircularBuffer
+\class LinearBuffer
 \ingroup FX-Objects
 \brief
-The CircularBuffer object implements a simple circular buffer. It uses a wrap mask to wrap the read or write index quickly.
+The LinearBuffer object implements a linear buffer of type T. It allows easy wrapping of a smart pointer object.
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+template <typename T>
+class LinearBuffer
+{
+public:
+	LinearBuffer() {}	/* C-TOR */
+	~LinearBuffer() {}	/* D-TOR */
+
+	/** flush buffer by resetting all values to 0.0 */
+	void flushBuffer() { memset(&buffer[0], 0, bufferLength * sizeof(T)); }
+
+	/** Create a buffer based on a target maximum in SAMPLES
+	//	   do NOT call from realtime audio thread; do this prior to any processing */
+	void createLinearBuffer(unsigned int _bufferLength)
+	{
+		// --- same length and the block is still valid: just flush it
+		if (buffer && _bufferLength == bufferLength && (arena ? arenaGeneration == arena->getGeneration() : !!ownedBuffer))
+		{
+			flushBuffer();
+			return;
+		}
+
+		// --- find nearest power of 2 for buffer, save it as bufferLength
+		bufferLength = _bufferLength;
+
+		// --- create new buffer (arena blocks are already zeroed)
+		if (arena)
+		{
+			ownedBuffer.reset();
+			buffer = arena->allocate<T>(bufferLength);
+			arenaGeneration = arena->getGeneration();
+		}
+		else
+		{
+			ownedBuffer.reset(new T[bufferLength]);
+			buffer = ownedBuffer.get();
+			flushBuffer();
+		}
+	}
+
+	/** carve the buffer from an arena (nullptr = heap); takes effect at the next createLinearBuffer( ) */
+	void setArena(AudioArena* _arena) { arena = _arena; }
+
+	/** write a value into the buffer; this overwrites the previous oldest value in the buffer */
+	void writeBuffer(unsigned int index, T input)
+	{
+		if (index >= bufferLength) return;
+
+		// --- write and increment index counter
+		buffer[index] = input;
+	}
+
+	/**  read an arbitrary location that is delayInSamples old */
+	T readBuffer(unsigned int index)//, bool readBeforeWrite = true)
+	{
+		if (index >= bufferLength) return 0.0;
+
+		// --- read it
+		return buffer[index];
+	}
+
+private:
+	T* buffer = nullptr;						///< the buffer, owned or carved from the arena
+	std::unique_ptr<T[]> ownedBuffer = nullptr;	///< smart pointer will auto-delete (heap buffers only)
+	AudioArena* arena = nullptr;				///< arena to carve from, or nullptr
+	uint32_t arenaGeneration = 0;				///< arena generation the buffer was carved in
+	unsigned int bufferLength = 1024; ///< buffer length
+};
+
+
+/**
+\enum delayInterpolation
+\ingroup Constants-Enums
+\brief
+Use this strongly typed enum to select the fractional delay interpolator for CircularBuffer reads.
+
+- enum class delayInterpolation { kNone, kLinear, kLagrange, kThiran };
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+enum class delayInterpolation { kNone, kLinear, kLagrange, kThiran };
+
+const unsigned int DELAY_BLOCK_LEN = 64;	///< stack scratch length for the delay objects' block loops
+
+/**
+\class CircularBuffer
+\ingroup FX-Objects
+\brief
+The CircularBuffer object implements a simple circular buffer. It uses a wrap mask to wrap the read or write index quickly.
 
 \author Will Pirkle http://www.willpirkle.com
 \remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
@@ -2298,7 +3406,7 @@ public:
 	~CircularBuffer() {}	/* D-TOR */
 
 							/** flush buffer by resetting all values to 0.0 */
-	void flushBuffer(){ memset(&buffer[0], 0, bufferLength * sizeof(T)); }
+	void flushBuffer(){ memset(&buffer[0], 0, bufferLength * sizeof(T)); thiranState = 0.0; }
 
 	/** Create a buffer based on a target maximum in SAMPLES
 	//	   do NOT call from realtime audio thread; do this prior to any processing */
@@ -2315,6 +3423,13 @@ public:
 		// --- reset to top
 		writeIndex = 0;
 
+		// --- same length and the block is still valid: just flush it
+		if (buffer && _bufferLengthPowerOfTwo == bufferLength && (arena ? arenaGeneration == arena->getGeneration() : !!ownedBuffer))
+		{
+			flushBuffer();
+			return;
+		}
+
 		// --- find nearest power of 2 for buffer, save it as bufferLength
 		bufferLength = _bufferLengthPowerOfTwo;
 
@@ -2322,12 +3437,25 @@ public:
 		wrapMask = bufferLength - 1;
 
 		// --- create new buffer
-		buffer.reset(new T[bufferLength]);
+		if (arena)
+		{
+			ownedBuffer.reset();
+			buffer = arena->allocate<T>(bufferLength);
+			arenaGeneration = arena->getGeneration();
+		}
+		else
+		{
+			ownedBuffer.reset(new T[bufferLength]);
+			buffer = ownedBuffer.get();
+		}
 
 		// --- flush buffer
 		flushBuffer();
 	}
 
+	/** carve the buffer from an arena (nullptr = heap); takes effect at the next create call */
+	void setArena(AudioArena* _arena) { arena = _arena; }
+
 	/** write a value into the buffer; this overwrites the previous oldest value in the buffer */
 	void writeBuffer(T input)
 	{
@@ -2377,13 +3505,417 @@ public:
 	/** enable or disable interpolation; usually used for diagnostics or in algorithms that require strict integer samples times */
 	void setInterpolate(bool b) { interpolate = b; }
 
+	/** read an arbitrary location that includes a fractional sample with a chosen interpolator (ignores setInterpolate( )) */
+	T readBuffer(double delayInFractionalSamples, delayInterpolation type)
+	{
+		T output;
+		readBlock(&output, &delayInFractionalSamples, 1, type);
+		return output;
+	}
+
+	/** write a block of values; same as count calls to writeBuffer( ), but copied in (at most) two runs around the wrap point */
+	void writeBlock(const T* input, unsigned int count)
+	{
+		while (count > 0)
+		{
+			unsigned int run = bufferLength - writeIndex;
+			if (run > count) run = count;
+
+			memcpy(&buffer[writeIndex], input, run * sizeof(T));
+			writeIndex = (writeIndex + run) & wrapMask;
+			input += run;
+			count -= run;
+		}
+	}
+
+	/** read a block at a fixed integer delay; output[n] is what readBuffer(delayInSamples) would return in the n-th
+	    of count read-before-write cycles, so the block must only reach samples written before it: use getBlockReadLength( ) */
+	void readBlock(T* output, unsigned int count, unsigned int delayInSamples)
+	{
+		unsigned int readIndex = (writeIndex - 1 - delayInSamples) & wrapMask;
+		while (count > 0)
+		{
+			unsigned int run = bufferLength - readIndex;
+			if (run > count) run = count;
+
+			memcpy(output, &buffer[readIndex], run * sizeof(T));
+			readIndex = (readIndex + run) & wrapMask;
+			output += run;
+			count -= run;
+		}
+	}
+
+	/** read a block at a fixed fractional delay; see readBlock( ) above for the block rules */
+	void readBlock(T* output, unsigned int count, double delayInFractionalSamples, delayInterpolation type)
+	{
+		if (type == delayInterpolation::kThiran)
+		{
+			// --- recursive, so no gain from a fixed delay
+			for (unsigned int n = 0; n < count; n++)
+				output[n] = readThiran(delayInFractionalSamples, n);
+			return;
+		}
+
+		// --- fixed delay: one set of tap weights for the whole block
+		int newestTap = 0;
+		double weights[4];
+		getTapWeights(delayInFractionalSamples, type, newestTap, weights);
+
+		// --- taps are newestTap ... newestTap + 3; if they do not wrap inside the block, run a plain (vectorizable) FIR
+		const int first = (int)(writeIndex - 1) - newestTap - 3;
+		if (first >= 0 && first + 3 + (int)count <= (int)bufferLength)
+		{
+			const T* x = &buffer[first];
+			for (unsigned int n = 0; n < count; n++)
+				output[n] = (T)(weights[0] * x[n + 3] + weights[1] * x[n + 2] + weights[2] * x[n + 1] + weights[3] * x[n]);
+			return;
+		}
+
+		const unsigned int base = writeIndex - 1 - newestTap;
+		for (unsigned int n = 0; n < count; n++)
+		{
+			output[n] = (T)(weights[0] * buffer[(base + n) & wrapMask] + weights[1] * buffer[(base + n - 1) & wrapMask] +
+							weights[2] * buffer[(base + n - 2) & wrapMask] + weights[3] * buffer[(base + n - 3) & wrapMask]);
+		}
+	}
+
+	/** read a block with a per-sample fractional delay (modulated lines); delays[n] is the delay of the n-th read */
+	void readBlock(T* output, const double* delays, unsigned int count, delayInterpolation type)
+	{
+		if (type == delayInterpolation::kThiran)
+		{
+			for (unsigned int n = 0; n < count; n++)
+				output[n] = readThiran(delays[n], n);
+			return;
+		}
+
+		for (unsigned int n = 0; n < count; n++)
+		{
+			int newestTap = 0;
+			double weights[4];
+			getTapWeights(delays[n], type, newestTap, weights);
+
+			const unsigned int base = writeIndex - 1 + n - newestTap;
+			output[n] = (T)(weights[0] * buffer[base & wrapMask] + weights[1] * buffer[(base - 1) & wrapMask] +
+							weights[2] * buffer[(base - 2) & wrapMask] + weights[3] * buffer[(base - 3) & wrapMask]);
+		}
+	}
+
+	/** how many of the next count reads at this delay touch only samples already written (at least 1) */
+	static unsigned int getBlockReadLength(double delayInFractionalSamples, unsigned int count, delayInterpolation type)
+	{
+		// --- read n reaches back to (newest tap - n), which must be >= 0
+		unsigned int length = (unsigned int)getNewestTap(delayInFractionalSamples, type) + 1;
+		return length < count ? length : count;
+	}
+
+	/** per-sample delay version of getBlockReadLength( ) */
+	static unsigned int getBlockReadLength(const double* delays, unsigned int count, delayInterpolation type)
+	{
+		unsigned int length = 1;
+		while (length < count && getNewestTap(delays[length], type) >= (int)length)
+			length++;
+		return length;
+	}
+
 private:
-	std::unique_ptr<T[]> buffer = nullptr;	///< smart pointer will auto-delete
+	/** integer delay of the newest sample a read touches */
+	static inline int getNewestTap(double delay, delayInterpolation type)
+	{
+		if (type == delayInterpolation::kThiran)
+			return delay > 0.5 ? (int)(delay - 0.5) : 0;
+
+		const int intDelay = (int)delay;
+		if (type == delayInterpolation::kLagrange && intDelay > 0)
+			return intDelay - 1;
+		return intDelay;
+	}
+
+	/** weights of the four taps newestTap ... newestTap + 3 (newest first) */
+	static inline void getTapWeights(double delay, delayInterpolation type, int& newestTap, double* weights)
+	{
+		const int intDelay = (int)delay;
+		const double f = delay - intDelay;
+
+		if (type == delayInterpolation::kLagrange && intDelay > 0)
+		{
+			// --- 3rd order Lagrange on taps at -1, 0, 1, 2 around the integer delay; same weights that
+			//     doLagrangeInterpolation( ) forms for x = {-1, 0, 1, 2}, xbar = f, without its divisions
+			newestTap = intDelay - 1;
+			weights[0] = -f * (f - 1.0) * (f - 2.0) / 6.0;
+			weights[1] = (f + 1.0) * (f - 1.0) * (f - 2.0) * 0.5;
+			weights[2] = -(f + 1.0) * f * (f - 2.0) * 0.5;
+			weights[3] = (f + 1.0) * f * (f - 1.0) / 6.0;
+			return;
+		}
+
+		// --- linear (also Lagrange below one sample) or none; the taps past the second are zero-weighted
+		newestTap = intDelay - 1;
+		weights[0] = 0.0;
+		weights[1] = type == delayInterpolation::kNone ? 1.0 : 1.0 - f;
+		weights[2] = type == delayInterpolation::kNone ? 0.0 : f;
+		weights[3] = 0.0;
+	}
+
+	/** first order Thiran allpass on the integer-delayed signal; the fraction is kept in [0.5, 1.5) where the
+	    allpass phase delay is flattest; n is the read's offset in the current block */
+	inline T readThiran(double delay, unsigned int n)
+	{
+		const int intDelay = getNewestTap(delay, delayInterpolation::kThiran);
+		const double d = delay - intDelay;
+		const double a = (1.0 - d) / (1.0 + d);
+
+		const unsigned int readIndex = writeIndex - 1 + n - intDelay;
+		const double x0 = buffer[readIndex & wrapMask];
+		const double x1 = buffer[(readIndex - 1) & wrapMask];
+
+		// --- y(n) = a x (x(n) - y(n-1)) + x(n-1)
+		thiranState = a * (x0 - thiranState) + x1;
+		return (T)thiranState;
+	}
+
+	T* buffer = nullptr;						///< the buffer, owned or carved from the arena
+	std::unique_ptr<T[]> ownedBuffer = nullptr;	///< smart pointer will auto-delete (heap buffers only)
+	AudioArena* arena = nullptr;				///< arena to carve from, or nullptr
+	uint32_t arenaGeneration = 0;				///< arena generation the buffer was carved in
 	unsigned int writeIndex = 0;		///> write index
 	unsigned int bufferLength = 1024;	///< must be nearest power of 2
 	unsigned int wrapMask = 1023;		///< must be (bufferLength - 1)
 	bool interpolate = true;			///< interpolation (default is ON)
+	double thiranState = 0.0;			///< Thiran allpass output register (one reader per buffer)
+};
+
+
+// --- FFTW ---
+#ifdef HAVE_FFTW
+#include "fftw3.h"
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <string>
+#include "atomicops.h"
+
+/**
+\enum fftPlanType
+\ingroup Constants-Enums
+\brief
+Use this strongly typed enum to request a plan from the FFTPlanRegistry.
+
+- enum class fftPlanType { kRealForward, kRealInverse, kComplexForward, kComplexInverse };
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 18
+*/
+enum class fftPlanType { kRealForward, kRealInverse, kComplexForward, kComplexInverse };
+
+/**
+\class FFTPlanRegistry
+\ingroup FFTW-Objects
+\brief
+The FFTPlanRegistry is the process-wide cache of FFTW plans; every FFT object in this file gets its plans here.
+
+- plans are keyed by length and type and are created once (FFTW_MEASURE by default), then shared by every instance
+- all plans are out-of-place and created on scratch fftw_malloc( ) arrays; callers must execute them with the
+  new-array functions (fftw_execute_dft_r2c( ), fftw_execute_dft_c2r( ), fftw_execute_dft( )) on fftw_malloc( ) buffers
+- the FFTW planner is not thread-safe, so plan creation and wisdom I/O are serialized on one mutex; executing
+  a plan is thread-safe and takes no lock
+- c2r plans may overwrite their input spectrum, as FFTW allows
+- wisdom can be persisted: setWisdomFile( ) imports the file and re-exports it whenever a new plan is measured;
+  define FFTW_WISDOM_FILE to do this automatically on first use
+
+Control I/F:
+- getPlan( ) may plan, so call it from initialization code only; plans live until the process exits.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 18
+*/
+class FFTPlanRegistry
+{
+public:
+	/** the one registry */
+	static FFTPlanRegistry& getInstance();
+
+	/** get (creating if needed) the shared plan for this length and type */
+	fftw_plan getPlan(unsigned int length, fftPlanType type);
+
+	/** planner flags for plans created from now on; default is FFTW_MEASURE */
+	void setPlannerFlags(unsigned int flags);
+
+	/** import wisdom from this file now and export to it whenever a new plan is created; nullptr stops persisting */
+	bool setWisdomFile(const char* filename);
+
+	/** import wisdom from a file; returns false if it could not be read */
+	bool importWisdom(const char* filename);
+
+	/** export the accumulated wisdom to a file */
+	bool exportWisdom(const char* filename);
+
+private:
+	FFTPlanRegistry();		/* C-TOR */
+	~FFTPlanRegistry();		/* D-TOR */
+	FFTPlanRegistry(const FFTPlanRegistry&) = delete;
+	FFTPlanRegistry& operator=(const FFTPlanRegistry&) = delete;
+
+	/** create a plan on scratch buffers; the mutex must be held */
+	fftw_plan createPlan(unsigned int length, fftPlanType type);
+
+	std::mutex plannerMutex;							///< serializes the FFTW planner
+	std::map<unsigned long long, fftw_plan> plans;		///< (length, type) -> plan
+	unsigned int plannerFlags = FFTW_MEASURE;			///< flags for new plans
+	std::string wisdomFile;								///< persisted wisdom, empty = none
+};
+
+// --- default partition length for the ImpulseConvolver's partitioned engine
+const unsigned int CONVOLVER_PARTITION_LEN = 64;
+
+/**
+@complexMultiplyAccumulate
+\ingroup FFTW-Objects
+
+@brief acc += x * h over split (separate real and imaginary) complex arrays; the layout lets the compiler vectorize the loop
+
+\param xReal - signal spectrum, real parts
+\param xImag - signal spectrum, imaginary parts
+\param hReal - filter spectrum, real parts
+\param hImag - filter spectrum, imaginary parts
+\param accReal - accumulator, real parts
+\param accImag - accumulator, imaginary parts
+\param count - number of bins
+*/
+inline void complexMultiplyAccumulate(const double* xReal, const double* xImag, const double* hReal, const double* hImag,
+									  double* accReal, double* accImag, unsigned int count)
+{
+	for (unsigned int k = 0; k < count; k++)
+	{
+		accReal[k] += xReal[k] * hReal[k] - xImag[k] * hImag[k];
+		accImag[k] += xReal[k] * hImag[k] + xImag[k] * hReal[k];
+	}
+}
+
+/**
+\class PartitionedConvolver
+\ingroup FFTW-Objects
+\brief
+The PartitionedConvolver implements zero-latency uniformly partitioned overlap-save convolution.
+
+- the first partitionLength taps (the head) run as a direct-form FIR on a mirrored history buffer
+- the remaining taps are split into partitionLength segments whose spectra (FFT length 2 x partitionLength, r2c)
+  are precomputed when the IR is loaded; each completed input block is transformed once, pushed into a frequency
+  domain delay line and multiply-accumulated against all partition spectra, then one c2r produces the tail for
+  the next block
+- complex data is stored split (real and imaginary arrays) so the multiply-accumulate loop vectorizes
+- the per-sample cost is the head FIR plus the amortized block work, so IRs of tens of thousands of taps are fine
+
+Audio I/O:
+- processes mono input into mono output with no latency; processAudioBlock( ) for buffers.
+
+Control I/F:
+- initialize( ) allocates for a maximum IR length, as one AudioArena block (not real-time safe)
+- setImpulseResponse( ) loads an IR without allocating as long as it fits the initialized capacity
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 18
+*/
+class PartitionedConvolver
+{
+public:
+	PartitionedConvolver() {}					/* C-TOR */
+	~PartitionedConvolver() { destroyFFTW(); }	/* D-TOR */
+
+	/** allocate buffers and plans; partitionLength must be a power of 2 (>= 4) */
+	void initialize(unsigned int _partitionLength, unsigned int _maxIRLength);
+
+	/** destroy FFTW objects, plans and buffers */
+	void destroyFFTW();
+
+	/** load an IR; re-initializes (allocates) only if irLength exceeds the current capacity */
+	void setImpulseResponse(const double* irArray, unsigned int irLength);
+
+	/** flush the signal history and the frequency domain delay line; the IR is kept */
+	void reset();
+
+	/** process one sample */
+	inline double processAudioSample(double xn)
+	{
+		// --- head: direct form over the last partitionLength inputs (contiguous in the mirrored history)
+		history[historyIndex] = xn;
+		history[historyIndex + partitionLength] = xn;
+
+		const double* x = &history[historyIndex + 1];
+		double sum0 = 0.0, sum1 = 0.0, sum2 = 0.0, sum3 = 0.0;
+		for (unsigned int i = 0; i < partitionLength; i += 4)
+		{
+			sum0 += headReversed[i] * x[i];
+			sum1 += headReversed[i + 1] * x[i + 1];
+			sum2 += headReversed[i + 2] * x[i + 2];
+			sum3 += headReversed[i + 3] * x[i + 3];
+		}
+		historyIndex = (historyIndex + 1) & (partitionLength - 1);
+
+		// --- tail: computed at the end of the previous block
+		double yn = (sum0 + sum1) + (sum2 + sum3) + tailOutput[blockIndex];
+
+		inputFrame[partitionLength + blockIndex] = xn;
+		if (++blockIndex == partitionLength)
+		{
+			blockIndex = 0;
+			processPartitions();
+		}
+
+		return yn;
+	}
+
+	/** process a block; in and out may be the same buffer */
+	void processAudioBlock(const double* in, double* out, unsigned int count)
+	{
+		for (unsigned int i = 0; i < count; i++)
+			out[i] = processAudioSample(in[i]);
+	}
+
+	/** get the partition (head) length */
+	unsigned int getPartitionLength() { return partitionLength; }
+
+	/** get the current IR length */
+	unsigned int getIRLength() { return irLength; }
+
+protected:
+	/** FFT the completed input block, multiply-accumulate the partitions and inverse FFT the tail */
+	void processPartitions();
+
+	AudioArena arena;						///< one block for every buffer below
+	fftw_plan plan_forward = nullptr;		///< shared r2c plan, 2 x partitionLength
+	fftw_plan plan_backward = nullptr;		///< shared c2r plan, 2 x partitionLength
+	double* inputFrame = nullptr;			///< [previous block | current block]
+	double* irFrame = nullptr;				///< zero-padded partition for IR transforms
+	fftw_complex* spectrum = nullptr;		///< r2c output
+	fftw_complex* accumulator = nullptr;	///< c2r input
+	double* ifftOutput = nullptr;			///< c2r output
+
+	double* headReversed = nullptr;			///< first partitionLength taps, reversed
+	double* history = nullptr;				///< mirrored input history, 2 x partitionLength
+	double* tailOutput = nullptr;			///< tail output for the current block
+
+	double* fdlReal = nullptr;				///< frequency domain delay line, maxPartitions x numBins
+	double* fdlImag = nullptr;				///< frequency domain delay line, maxPartitions x numBins
+	double* irReal = nullptr;				///< partition spectra, maxPartitions x numBins
+	double* irImag = nullptr;				///< partition spectra, maxPartitions x numBins
+	double* accReal = nullptr;				///< multiply-accumulate result, numBins
+	double* accImag = nullptr;				///< multiply-accumulate result, numBins
+
+	unsigned int partitionLength = 0;		///< head and partition length (B)
+	unsigned int fftLength = 0;				///< 2B
+	unsigned int numBins = 0;				///< B + 1
+	unsigned int maxPartitions = 0;			///< tail partitions allocated
+	unsigned int numPartitions = 0;			///< tail partitions in use
+	unsigned int irLength = 0;				///< current IR length
+	unsigned int historyIndex = 0;			///< head history write index
+	unsigned int blockIndex = 0;			///< position in the current block
+	unsigned int fdlIndex = 0;				///< newest slot in the delay line
 };
+#endif
 
 
 /**
@@ -2393,6 +3925,9 @@ private:
 The ImpulseConvolver object implements a linear conovlver. NOTE: compile in Release mode or you may experice stuttering,
 glitching or other sample-drop activity.
 
+With HAVE_FFTW the convolution runs on the PartitionedConvolver (zero latency, fixed per-sample cost); otherwise it
+falls back to the direct form loop.
+
 Audio I/O:
 - Processes mono input to mono output.
 
@@ -2416,24 +3951,32 @@ public:
 	virtual bool reset(double _sampleRate)
 	{
 		// --- flush signal buffer; IR buffer is static
+#ifdef HAVE_FFTW
+		convolver.reset();
+#else
 		signalBuffer.flushBuffer();
+#endif
 		return true;
 	}
 
-	/** process one input - note this is CPU intensive as it performs simple linear convolution */
+	/** process one input through the convolver */
 	/**
 	\param xn input
 	\return the processed sample
 	*/
 	virtual double processAudioSample(double xn)
 	{
+#ifdef HAVE_FFTW
+		// --- partitioned FFT convolution, zero latency
+		return convolver.processAudioSample(xn);
+#else
 		double output = 0.0;
 
 		// --- write buffer; x(n) overwrites oldest value
 		//     this is the only time we do not read before write!
 		signalBuffer.writeBuffer(xn);
 
-		// --- do the convolution
+		// --- do the convolution; note this is CPU intensive as it performs simple linear convolution
 		for (unsigned int i = 0; i < length; i++)
 		{
 			// --- y(n) += x(n)h(n)
@@ -2447,6 +3990,23 @@ public:
 		}
 
 		return output;
+#endif
+	}
+
+	/** process a block; in and out may be the same buffer */
+	/**
+	\param in input buffer
+	\param out output buffer
+	\param count number of samples
+	*/
+	virtual void processAudioBlock(const double* in, double* out, uint32_t count)
+	{
+#ifdef HAVE_FFTW
+		convolver.processAudioBlock(in, out, count);
+#else
+		for (unsigned int i = 0; i < count; i++)
+			out[i] = processAudioSample(in[i]);
+#endif
 	}
 
 	/** return false: this object only processes samples */
@@ -2457,13 +4017,22 @@ public:
 	{
 		length = lengthPowerOfTwo;
 		// --- create (and clear out) the buffers
+#ifdef HAVE_FFTW
+		convolver.initialize(CONVOLVER_PARTITION_LEN, lengthPowerOfTwo);
+#else
 		signalBuffer.createCircularBufferPowerOfTwo(lengthPowerOfTwo);
 		irBuffer.createLinearBuffer(lengthPowerOfTwo);
+#endif
 	}
 
 	/** set the impulse response */
 	void setImpulseResponse(double* irArray, unsigned int lengthPowerOfTwo)
 	{
+#ifdef HAVE_FFTW
+		// --- allocation-free unless the IR outgrows the initialized length
+		length = lengthPowerOfTwo;
+		convolver.setImpulseResponse(irArray, lengthPowerOfTwo);
+#else
 		if (lengthPowerOfTwo != length)
 		{
 			length = lengthPowerOfTwo;
@@ -2477,12 +4046,17 @@ public:
 		{
 			irBuffer.writeBuffer(i, irArray[i]);
 		}
+#endif
 	}
 
 protected:
+#ifdef HAVE_FFTW
+	PartitionedConvolver convolver; ///< partitioned FFT convolution engine
+#else
 	// --- delay buffer of doubles
 	CircularBuffer<double> signalBuffer; ///< circulat buffer for the signal
 	LinearBuffer<double> irBuffer;	///< linear buffer for the IR
+#endif
 
 	unsigned int length = 0;	///< length of convolution (buffer)
 
@@ -2556,6 +4130,9 @@ public:
 		sampleRate = _sampleRate;
 		convolver.reset(_sampleRate);
 		convolver.init(IR_LEN);
+
+		// --- init( ) clears the IR; reload the current one
+		convolver.setImpulseResponse(irArray, IR_LEN);
 		return true;
 	}
 
@@ -2570,6 +4147,17 @@ public:
 		return convolver.processAudioSample(xn);
 	}
 
+	/** perform the convolution on a block; in and out may be the same buffer */
+	/**
+	\param in input buffer
+	\param out output buffer
+	\param count number of samples
+	*/
+	virtual void processAudioBlock(const double* in, double* out, uint32_t count)
+	{
+		convolver.processAudioBlock(in, out, count);
+	}
+
 	/** return false: this object only processes samples */
 	virtual bool canProcessAudioFrame() { return false; }
 
@@ -2667,6 +4255,7 @@ Custom parameter structure for the AudioDelay object.
 struct AudioDelayParameters
 {
 	AudioDelayParameters() {}
+	AudioDelayParameters(const AudioDelayParameters& params) = default;
 	/** all FXObjects parameter objects require overloaded= operator so remember to add new entries if you add new variables. */
 	AudioDelayParameters& operator=(const AudioDelayParameters& params)	// need this override for collections to work
 	{
@@ -2682,6 +4271,7 @@ struct AudioDelayParameters
 		leftDelay_mSec = params.leftDelay_mSec;
 		rightDelay_mSec = params.rightDelay_mSec;
 		delayRatio_Pct = params.delayRatio_Pct;
+		interpolation = params.interpolation;
 
 		return *this;
 	}
@@ -2696,6 +4286,7 @@ struct AudioDelayParameters
 	double leftDelay_mSec = 0.0;	///< left delay time
 	double rightDelay_mSec = 0.0;	///< right delay time
 	double delayRatio_Pct = 100.0;	///< dela ratio: right length = (delayRatio)*(left length)
+	delayInterpolation interpolation = delayInterpolation::kLinear; ///< fractional delay interpolator
 };
 
 /**
@@ -2748,7 +4339,7 @@ public:
 	virtual double processAudioSample(double xn)
 	{
 		// --- read delay
-		double yn = delayBuffer_L.readBuffer(delayInSamples_L);
+		double yn = delayBuffer_L.readBuffer(delayInSamples_L, parameters.interpolation);
 
 		// --- create input for delay buffer
 		double dn = xn + (parameters.feedback_Pct / 100.0) * yn;
@@ -2799,10 +4390,10 @@ public:
 		double xnR = inputChannels > 1 ? inputFrame[1] : xnL;
 
 		// --- read delay LEFT
-		double ynL = delayBuffer_L.readBuffer(delayInSamples_L);
+		double ynL = delayBuffer_L.readBuffer(delayInSamples_L, parameters.interpolation);
 
 		// --- read delay RIGHT
-		double ynR = delayBuffer_R.readBuffer(delayInSamples_R);
+		double ynR = delayBuffer_R.readBuffer(delayInSamples_R, parameters.interpolation);
 
 		// --- create input for delay buffer with LEFT channel info
 		double dnL = xnL + (parameters.feedback_Pct / 100.0) * ynL;
@@ -2843,6 +4434,50 @@ public:
 		return true;
 	}
 
+	/** process a MONO block; same result as numSamples calls to processAudioSample( ) */
+	virtual void processAudioBlock(const double* input, double* output, uint32_t numSamples)
+	{
+		processDelayBlock(input, nullptr, output, nullptr, nullptr, nullptr, numSamples);
+	}
+
+	/** process a STEREO block (kNormal or kPingPong); same result as numSamples calls to processAudioFrame( );
+	    an output may alias its own input but not the other channel's */
+	bool processStereoBlock(const double* inputL, const double* inputR, double* outputL, double* outputR, uint32_t numSamples)
+	{
+		if (parameters.algorithm != delayAlgorithm::kNormal &&
+			parameters.algorithm != delayAlgorithm::kPingPong)
+			return false;
+
+		processDelayBlock(inputL, inputR, outputL, outputR, nullptr, nullptr, numSamples);
+		return true;
+	}
+
+	/** process a STEREO block with per-sample delay times in samples (modulated delays); the parameter delay times are ignored */
+	bool processModulatedStereoBlock(const double* inputL, const double* inputR, double* outputL, double* outputR,
+									 const double* delaysL, const double* delaysR, uint32_t numSamples)
+	{
+		if (parameters.algorithm != delayAlgorithm::kNormal &&
+			parameters.algorithm != delayAlgorithm::kPingPong)
+			return false;
+
+		processDelayBlock(inputL, inputR, outputL, outputR, delaysL, delaysR, numSamples);
+		return true;
+	}
+
+	/** process a MONO block with per-sample delay times in samples; same algorithm check as the mono processAudioFrame( ) */
+	bool processModulatedAudioBlock(const double* input, double* output, const double* delays, uint32_t numSamples)
+	{
+		if (parameters.algorithm != delayAlgorithm::kNormal &&
+			parameters.algorithm != delayAlgorithm::kPingPong)
+			return false;
+
+		processDelayBlock(input, nullptr, output, nullptr, delays, nullptr, numSamples);
+		return true;
+	}
+
+	/** samples per millisecond at the current sample rate */
+	double getSamplesPerMSec() { return samplesPerMSec; }
+
 	/** get parameters: note use of custom structure for passing param data */
 	/**
 	\return AudioDelayParameters custom data structure
@@ -2907,7 +4542,80 @@ public:
 		delayBuffer_R.createCircularBuffer(bufferLength);
 	}
 
+	/** carve the delay buffers from an arena (nullptr = heap); takes effect at the next createDelayBuffers( ) */
+	void setArena(AudioArena* arena)
+	{
+		delayBuffer_L.setArena(arena);
+		delayBuffer_R.setArena(arena);
+	}
+
 private:
+	/** block core: inputR == nullptr is MONO (LEFT buffer only); null delay arrays use the parameter delay times */
+	void processDelayBlock(const double* inputL, const double* inputR, double* outputL, double* outputR,
+						   const double* delaysL, const double* delaysR, uint32_t numSamples)
+	{
+		const double feedback = parameters.feedback_Pct / 100.0;
+		const delayInterpolation type = parameters.interpolation;
+		const bool pingPong = inputR && parameters.algorithm == delayAlgorithm::kPingPong;
+
+		double ynL[DELAY_BLOCK_LEN];
+		double ynR[DELAY_BLOCK_LEN];
+		double dnL[DELAY_BLOCK_LEN];
+		double dnR[DELAY_BLOCK_LEN];
+
+		uint32_t done = 0;
+		while (done < numSamples)
+		{
+			// --- chunk so that every read sees only samples written before the chunk; with feedback
+			//     this is what keeps the block loop identical to the per-sample one
+			uint32_t count = numSamples - done;
+			if (count > DELAY_BLOCK_LEN) count = DELAY_BLOCK_LEN;
+
+			count = delaysL ? CircularBuffer<double>::getBlockReadLength(delaysL + done, count, type) :
+							  CircularBuffer<double>::getBlockReadLength(delayInSamples_L, count, type);
+			if (inputR)
+				count = delaysR ? CircularBuffer<double>::getBlockReadLength(delaysR + done, count, type) :
+								  CircularBuffer<double>::getBlockReadLength(delayInSamples_R, count, type);
+
+			// --- read delays
+			if (delaysL) delayBuffer_L.readBlock(ynL, delaysL + done, count, type);
+			else delayBuffer_L.readBlock(ynL, count, delayInSamples_L, type);
+
+			if (inputR)
+			{
+				if (delaysR) delayBuffer_R.readBlock(ynR, delaysR + done, count, type);
+				else delayBuffer_R.readBlock(ynR, count, delayInSamples_R, type);
+			}
+
+			// --- feedback and mix; the LEFT and RIGHT loops are independent so each vectorizes
+			const double* xnL = inputL + done;
+			double* outL = outputL + done;
+			for (uint32_t n = 0; n < count; n++)
+			{
+				dnL[n] = xnL[n] + feedback * ynL[n];
+				outL[n] = dryMix * xnL[n] + wetMix * ynL[n];
+			}
+
+			if (inputR)
+			{
+				const double* xnR = inputR + done;
+				double* outR = outputR + done;
+				for (uint32_t n = 0; n < count; n++)
+				{
+					dnR[n] = xnR[n] + feedback * ynR[n];
+					outR[n] = dryMix * xnR[n] + wetMix * ynR[n];
+				}
+			}
+
+			// --- write delays (crossed for ping-pong)
+			delayBuffer_L.writeBlock(pingPong ? dnR : dnL, count);
+			if (inputR)
+				delayBuffer_R.writeBlock(pingPong ? dnL : dnR, count);
+
+			done += count;
+		}
+	}
+
 	AudioDelayParameters parameters; ///< object parameters
 
 	double sampleRate = 0.0;		///< current sample rate
@@ -2970,15 +4678,20 @@ struct OscillatorParameters
 	double frequency_Hz = 0.0;	///< oscillator frequency
 };
 
+// --- LFO block rendering
+const unsigned int LFO_WAVETABLE_LEN = 1024;		///< one sine cycle; linear interpolation error is below 5e-6
+const unsigned int MODULATION_BLOCK_LEN = 64;		///< stack modulation buffer length for block-rate consumers
+
 /**
 \class LFO
 \ingroup FX-Objects
 \brief
 The LFO object implements a mathematically perfect LFO generator for modulation uses only. It should not be used for
-audio frequencies except for the sinusoidal output which, though an approximation, has very low TDH.
+audio frequencies except for the sinusoidal output which, read from a shared interpolated wavetable, has very low TDH.
 
 Audio I/O:
 - Output only object: low frequency generator.
+- renderModulationBlock( ) fills modulation buffers a block at a time for block-rate consumers.
 
 Control I/F:
 - Use OscillatorParameters structure to get/set object params.
@@ -3029,6 +4742,10 @@ public:
 	/** render a new audio output structure */
 	virtual const SignalGenData renderAudioOutput();
 
+	/** render count samples of the normal and/or quad phase (+90 degree) outputs; either pointer may be null.
+	    Same phase as count calls to renderAudioOutput( ), with one waveform decision per block */
+	void renderModulationBlock(double* normalOutput, double* quadPhaseOutput, uint32_t count);
+
 protected:
 	// --- parameters
 	OscillatorParameters lfoParameters; ///< obejcgt parameters
@@ -3291,6 +5008,7 @@ struct ModulatedDelayParameters
 		lfoRate_Hz = params.lfoRate_Hz;
 		lfoDepth_Pct = params.lfoDepth_Pct;
 		feedback_Pct = params.feedback_Pct;
+		interpolation = params.interpolation;
 		return *this;
 	}
 
@@ -3299,6 +5017,7 @@ struct ModulatedDelayParameters
 	double lfoRate_Hz = 0.0;	///< mod delay LFO rate in Hz
 	double lfoDepth_Pct = 0.0;	///< mod delay LFO depth in %
 	double feedback_Pct = 0.0;	///< feedback in %
+	delayInterpolation interpolation = delayInterpolation::kLinear; ///< fractional delay interpolator
 };
 
 /**
@@ -3342,6 +5061,9 @@ public:
 		return true;
 	}
 
+	/** carve the delay buffers from an arena (nullptr = heap); takes effect at the next reset( ) */
+	void setArena(AudioArena* arena) { delay.setArena(arena); }
+
 	/** process input sample */
 	/**
 	\param xn input
@@ -3372,47 +5094,12 @@ public:
 		SignalGenData lfoOutput = lfo.renderAudioOutput();
 
 		// --- setup delay modulation
-		AudioDelayParameters params = delay.getParameters();
-		double minDelay_mSec = 0.0;
-		double maxDepth_mSec = 0.0;
-
-		// --- set delay times, wet/dry and feedback
-		if (parameters.algorithm == modDelaylgorithm::kFlanger)
-		{
-			minDelay_mSec = 0.1;
-			maxDepth_mSec = 7.0;
-			params.wetLevel_dB = -3.0;
-			params.dryLevel_dB = -3.0;
-		}
-		if (parameters.algorithm == modDelaylgorithm::kChorus)
-		{
-			minDelay_mSec = 10.0;
-			maxDepth_mSec = 30.0;
-			params.wetLevel_dB = -3.0;
-			params.dryLevel_dB = -0.0;
-			params.feedback_Pct = 0.0;
-		}
-		if (parameters.algorithm == modDelaylgorithm::kVibrato)
-		{
-			minDelay_mSec = 0.0;
-			maxDepth_mSec = 7.0;
-			params.wetLevel_dB = 0.0;
-			params.dryLevel_dB = -96.0;
-			params.feedback_Pct = 0.0;
-		}
-
-		// --- calc modulated delay times
-		double depth = parameters.lfoDepth_Pct / 100.0;
-		double modulationMin = minDelay_mSec;
-		double modulationMax = minDelay_mSec + maxDepth_mSec;
-
-		// --- flanger - unipolar
-		if (parameters.algorithm == modDelaylgorithm::kFlanger)
-			params.leftDelay_mSec = doUnipolarModulationFromMin(bipolarToUnipolar(depth * lfoOutput.normalOutput),
-															     modulationMin, modulationMax);
-		else
-			params.leftDelay_mSec = doBipolarModulation(depth * lfoOutput.normalOutput, modulationMin, modulationMax);
+		double modulationMin = 0.0;
+		double modulationMax = 0.0;
+		AudioDelayParameters params = getModulationParameters(modulationMin, modulationMax);
 
+		// --- calc modulated delay time
+		params.leftDelay_mSec = getModulatedDelay_mSec(lfoOutput.normalOutput, modulationMin, modulationMax);
 
 		// --- set right delay to match (*Hint Homework!)
 		params.rightDelay_mSec = params.leftDelay_mSec;
@@ -3424,6 +5111,20 @@ public:
 		return delay.processAudioFrame(inputFrame, outputFrame, inputChannels, outputChannels);
 	}
 
+	/** process a MONO block; matches processAudioSample( ) to float precision (the frame path runs in float) */
+	virtual void processAudioBlock(const double* input, double* output, uint32_t numSamples)
+	{
+		// --- unsupported algorithm: silence, as the frame path leaves its output at 0.0
+		if (!processModulatedBlock(input, nullptr, output, nullptr, numSamples))
+			memset(output, 0, sizeof(double)*numSamples);
+	}
+
+	/** process a STEREO block; same result as numSamples calls to processAudioFrame( ) with stereo in and out */
+	bool processStereoBlock(const double* inputL, const double* inputR, double* outputL, double* outputR, uint32_t numSamples)
+	{
+		return processModulatedBlock(inputL, inputR, outputL, outputR, numSamples);
+	}
+
 	/** get parameters: note use of custom structure for passing param data */
 	/**
 	\return ModulatedDelayParameters custom data structure
@@ -3450,10 +5151,95 @@ public:
 
 		AudioDelayParameters adParams = delay.getParameters();
 		adParams.feedback_Pct = parameters.feedback_Pct;
+		adParams.interpolation = parameters.interpolation;
 		delay.setParameters(adParams);
 	}
 
 private:
+	/** block core: render the LFO into per-sample delay times; inputR == nullptr is MONO */
+	bool processModulatedBlock(const double* inputL, const double* inputR, double* outputL, double* outputR, uint32_t numSamples)
+	{
+		double modulationMin = 0.0;
+		double modulationMax = 0.0;
+		AudioDelayParameters params = getModulationParameters(modulationMin, modulationMax);
+		const double samplesPerMSec = delay.getSamplesPerMSec();
+
+		double delays[DELAY_BLOCK_LEN];
+		uint32_t done = 0;
+		while (done < numSamples)
+		{
+			uint32_t count = numSamples - done;
+			if (count > DELAY_BLOCK_LEN) count = DELAY_BLOCK_LEN;
+
+			// --- render the LFO into a per-sample delay track
+			lfo.renderModulationBlock(delays, nullptr, count);
+			for (uint32_t n = 0; n < count; n++)
+				delays[n] = samplesPerMSec * getModulatedDelay_mSec(delays[n], modulationMin, modulationMax);
+
+			// --- levels and feedback; the last delay time is kept so per-sample calls carry on from here
+			params.leftDelay_mSec = delays[count - 1] / samplesPerMSec;
+			params.rightDelay_mSec = params.leftDelay_mSec;
+			delay.setParameters(params);
+
+			bool handled = inputR ? delay.processModulatedStereoBlock(inputL + done, inputR + done, outputL + done, outputR + done, delays, delays, count) :
+									delay.processModulatedAudioBlock(inputL + done, outputL + done, delays, count);
+			if (!handled)
+				return false;
+
+			done += count;
+		}
+		return true;
+	}
+
+	/** delay parameters for the current algorithm: wet/dry and feedback, plus the modulation range in mSec */
+	AudioDelayParameters getModulationParameters(double& modulationMin, double& modulationMax)
+	{
+		AudioDelayParameters params = delay.getParameters();
+		double minDelay_mSec = 0.0;
+		double maxDepth_mSec = 0.0;
+
+		// --- set delay times, wet/dry and feedback
+		if (parameters.algorithm == modDelaylgorithm::kFlanger)
+		{
+			minDelay_mSec = 0.1;
+			maxDepth_mSec = 7.0;
+			params.wetLevel_dB = -3.0;
+			params.dryLevel_dB = -3.0;
+		}
+		if (parameters.algorithm == modDelaylgorithm::kChorus)
+		{
+			minDelay_mSec = 10.0;
+			maxDepth_mSec = 30.0;
+			params.wetLevel_dB = -3.0;
+			params.dryLevel_dB = -0.0;
+			params.feedback_Pct = 0.0;
+		}
+		if (parameters.algorithm == modDelaylgorithm::kVibrato)
+		{
+			minDelay_mSec = 0.0;
+			maxDepth_mSec = 7.0;
+			params.wetLevel_dB = 0.0;
+			params.dryLevel_dB = -96.0;
+			params.feedback_Pct = 0.0;
+		}
+
+		modulationMin = minDelay_mSec;
+		modulationMax = minDelay_mSec + maxDepth_mSec;
+		return params;
+	}
+
+	/** modulated delay time for one LFO output value */
+	inline double getModulatedDelay_mSec(double lfoValue, double modulationMin, double modulationMax)
+	{
+		double depth = parameters.lfoDepth_Pct / 100.0;
+
+		// --- flanger - unipolar
+		if (parameters.algorithm == modDelaylgorithm::kFlanger)
+			return doUnipolarModulationFromMin(bipolarToUnipolar(depth * lfoValue), modulationMin, modulationMax);
+
+		return doBipolarModulation(depth * lfoValue, modulationMin, modulationMax);
+	}
+
 	ModulatedDelayParameters parameters; ///< object parameters
 	AudioDelay delay;	///< the delay to modulate
 	LFO lfo;			///< the modulator
@@ -3483,6 +5269,7 @@ struct PhaseShifterParameters
 		lfoDepth_Pct = params.lfoDepth_Pct;
 		intensity_Pct = params.intensity_Pct;
 		quadPhaseLFO = params.quadPhaseLFO;
+		controlInterval_Samples = params.controlInterval_Samples;
 		return *this;
 	}
 
@@ -3491,6 +5278,7 @@ struct PhaseShifterParameters
 	double lfoDepth_Pct = 0.0;	///< phaser LFO depth in %
 	double intensity_Pct = 0.0;	///< phaser feedback in %
 	bool quadPhaseLFO = false;	///< quad phase LFO flag
+	unsigned int controlInterval_Samples = 16;	///< block processing: samples between APF coefficient updates, ramped in between
 };
 
 // --- constants for Phaser
@@ -3521,6 +5309,7 @@ The PhaseShifter object implements a six-stage phaser.
 
 Audio I/O:
 - Processes mono input to mono output.
+- processAudioBlock( ) renders the LFO per block and updates the APFs at the control interval.
 
 Control I/F:
 - Use BiquadParameters structure to get/set object params.
@@ -3537,14 +5326,6 @@ public:
 		OscillatorParameters lfoparams = lfo.getParameters();
 		lfoparams.waveform = generatorWaveform::kSin;// sine LFO for phaser
 		lfo.setParameters(lfoparams);
-
-		AudioFilterParameters params = apf[0].getParameters();
-		params.algorithm = filterAlgorithm::kAPF1;
-
-		for (int i = 0; i < PHASER_STAGES; i++)
-		{
-			apf[i].setParameters(params);
-		}
 	}	/* C-TOR */
 
 	~PhaseShifter(void) {}	/* D-TOR */
@@ -3553,13 +5334,16 @@ public:
 	/** reset members to initialized state */
 	virtual bool reset(double _sampleRate)
 	{
+		sampleRate = _sampleRate;
+
 		// --- reset LFO
 		lfo.reset(_sampleRate);
 
-		// --- reset APFs
-		for (int i = 0; i < PHASER_STAGES; i++){
-			apf[i].reset(_sampleRate);
-		}
+		// --- reset APFs; the next block snaps its coefficients instead of ramping
+		memset(&apf_x_z1[0], 0, sizeof(double)*PHASER_STAGES);
+		memset(&apf_y_z1[0], 0, sizeof(double)*PHASER_STAGES);
+		controlCounter = 0;
+		alphaValid = false;
 
 		return true;
 	}
@@ -3582,59 +5366,57 @@ public:
 		double modulatorValue = lfoValue*depth;
 
 		// --- calculate modulated values for each APF; note they have different ranges
-		AudioFilterParameters params = apf[0].getParameters();
-		params.fc = doBipolarModulation(modulatorValue, apf0_minF, apf0_maxF);
-		apf[0].setParameters(params);
-
-		params = apf[1].getParameters();
-		params.fc = doBipolarModulation(modulatorValue, apf1_minF, apf1_maxF);
-		apf[1].setParameters(params);
-
-		params = apf[2].getParameters();
-		params.fc = doBipolarModulation(modulatorValue, apf2_minF, apf2_maxF);
-		apf[2].setParameters(params);
+		calculateAPFCoefficients(modulatorValue, &alpha[0], false);
+		alphaValid = true;
+		controlCounter = 0;
 
-		params = apf[3].getParameters();
-		params.fc = doBipolarModulation(modulatorValue, apf3_minF, apf3_maxF);
-		apf[3].setParameters(params);
-
-		params = apf[4].getParameters();
-		params.fc = doBipolarModulation(modulatorValue, apf4_minF, apf4_maxF);
-		apf[4].setParameters(params);
-
-		params = apf[5].getParameters();
-		params.fc = doBipolarModulation(modulatorValue, apf5_minF, apf5_maxF);
-		apf[5].setParameters(params);
+		return processPhaser(xn);
+	}
 
-		// --- calculate gamma values
-		double gamma1 = apf[5].getG_value();
-		double gamma2 = apf[4].getG_value() * gamma1;
-		double gamma3 = apf[3].getG_value() * gamma2;
-		double gamma4 = apf[2].getG_value() * gamma3;
-		double gamma5 = apf[1].getG_value() * gamma4;
-		double gamma6 = apf[0].getG_value() * gamma5;
+	/** process a block: the LFO is rendered per block and the APF coefficients are recalculated every
+	    controlInterval_Samples with linear ramps in between, so they trail the LFO by one interval;
+	    in and out may be the same buffer */
+	virtual void processAudioBlock(const double* input, double* output, uint32_t numSamples)
+	{
+		const double depth = parameters.lfoDepth_Pct / 100.0;
+		const unsigned int interval = parameters.controlInterval_Samples > 0 ? parameters.controlInterval_Samples : 1;
+		double lfoBuffer[MODULATION_BLOCK_LEN];
 
-		// --- set the alpha0 value
-		double K = parameters.intensity_Pct / 100.0;
-		double alpha0 = 1.0 / (1.0 + K*gamma6);
+		uint32_t done = 0;
+		while (done < numSamples)
+		{
+			uint32_t count = numSamples - done;
+			if (count > MODULATION_BLOCK_LEN) count = MODULATION_BLOCK_LEN;
 
-		// --- create combined feedback
-		double Sn = gamma5*apf[0].getS_value() + gamma4*apf[1].getS_value() + gamma3*apf[2].getS_value() + gamma2*apf[3].getS_value() + gamma1*apf[4].getS_value() + apf[5].getS_value();
+			if (parameters.quadPhaseLFO)
+				lfo.renderModulationBlock(nullptr, lfoBuffer, count);
+			else
+				lfo.renderModulationBlock(lfoBuffer, nullptr, count);
 
-		// --- form input to first APF
-		double u = alpha0*(xn - K*Sn);
+			for (uint32_t n = 0; n < count; n++)
+			{
+				// --- control tick: new targets, ramp towards them over the interval
+				if (controlCounter == 0)
+				{
+					double target[PHASER_STAGES];
+					calculateAPFCoefficients(lfoBuffer[n] * depth, &target[0], true);
+					for (unsigned int i = 0; i < PHASER_STAGES; i++)
+					{
+						if (!alphaValid) alpha[i] = target[i];
+						alphaInc[i] = (target[i] - alpha[i]) / interval;
+					}
+					alphaValid = true;
+					controlCounter = interval;
+				}
 
-		// --- cascade of APFs (could also nest these in one massive line of code)
-		double APF1 = apf[0].processAudioSample(u);
-		double APF2 = apf[1].processAudioSample(APF1);
-		double APF3 = apf[2].processAudioSample(APF2);
-		double APF4 = apf[3].processAudioSample(APF3);
-		double APF5 = apf[4].processAudioSample(APF4);
-		double APF6 = apf[5].processAudioSample(APF5);
+				for (unsigned int i = 0; i < PHASER_STAGES; i++)
+					alpha[i] += alphaInc[i];
+				controlCounter--;
 
-		// --- sum with -3dB coefficients
-		double output = 0.707*xn + 0.707*APF6;
-		return output;
+				output[done + n] = processPhaser(input[done + n]);
+			}
+			done += count;
+		}
 	}
 
 	/** return false: this object only processes samples */
@@ -3664,9 +5446,73 @@ public:
 		parameters = params;
 	}
 protected:
+	/** first order APF coefficients (the kAPF1 AudioFilter alpha) for a bipolar modulator value;
+	    fast uses the fastTan( ) prewarp */
+	inline void calculateAPFCoefficients(double modulatorValue, double* alphas, bool fast)
+	{
+		for (unsigned int i = 0; i < PHASER_STAGES; i++)
+		{
+			double fc = doBipolarModulation(modulatorValue, apfMinF[i], apfMaxF[i]);
+			double t = fast ? fastTan((kPi*fc) / sampleRate) : tan((kPi*fc) / sampleRate);
+			alphas[i] = (t - 1.0) / (t + 1.0);
+		}
+	}
+
+	/** one sample through the Harma phaser structure with the current coefficients */
+	inline double processPhaser(double xn)
+	{
+		// --- calculate gamma values
+		double gamma1 = alpha[5];
+		double gamma2 = alpha[4] * gamma1;
+		double gamma3 = alpha[3] * gamma2;
+		double gamma4 = alpha[2] * gamma3;
+		double gamma5 = alpha[1] * gamma4;
+		double gamma6 = alpha[0] * gamma5;
+
+		// --- set the alpha0 value
+		double K = parameters.intensity_Pct / 100.0;
+		double alpha0 = 1.0 / (1.0 + K*gamma6);
+
+		// --- S values of the direct form APFs: x(n-1) - alpha*y(n-1)
+		double S[PHASER_STAGES];
+		for (unsigned int i = 0; i < PHASER_STAGES; i++)
+			S[i] = apf_x_z1[i] - alpha[i] * apf_y_z1[i];
+
+		// --- create combined feedback
+		double Sn = gamma5*S[0] + gamma4*S[1] + gamma3*S[2] + gamma2*S[3] + gamma1*S[4] + S[5];
+
+		// --- form input to first APF
+		double u = alpha0*(xn - K*Sn);
+
+		// --- cascade of APFs: y(n) = alpha*x(n) + x(n-1) - alpha*y(n-1)
+		for (unsigned int i = 0; i < PHASER_STAGES; i++)
+		{
+			double yn = alpha[i] * u + (apf_x_z1[i] - alpha[i] * apf_y_z1[i]);
+			hotPathUnderflowCheck(yn);
+			apf_x_z1[i] = u;
+			apf_y_z1[i] = yn;
+			u = yn;
+		}
+
+		// --- sum with -3dB coefficients
+		double output = 0.707*xn + 0.707*u;
+		return output;
+	}
+
 	PhaseShifterParameters parameters;  ///< the object parameters
-	AudioFilter apf[PHASER_STAGES];		///< six APF objects
 	LFO lfo;							///< the one and only LFO
+	double sampleRate = 44100.0;		///< current sample rate
+
+	// --- six first order APFs, direct form
+	double alpha[PHASER_STAGES] = { 0.0 };		///< APF coefficients
+	double alphaInc[PHASER_STAGES] = { 0.0 };	///< per-sample coefficient ramp (block processing)
+	double apf_x_z1[PHASER_STAGES] = { 0.0 };	///< APF x(n-1) registers
+	double apf_y_z1[PHASER_STAGES] = { 0.0 };	///< APF y(n-1) registers
+	unsigned int controlCounter = 0;			///< samples left until the next control tick
+	bool alphaValid = false;					///< false until coefficients have been calculated
+
+	double apfMinF[PHASER_STAGES] = { apf0_minF, apf1_minF, apf2_minF, apf3_minF, apf4_minF, apf5_minF };	///< APF minimum fc
+	double apfMaxF[PHASER_STAGES] = { apf0_maxF, apf1_maxF, apf2_maxF, apf3_maxF, apf4_maxF, apf5_maxF };	///< APF maximum fc
 };
 
 /**
@@ -3900,6 +5746,9 @@ public:
 		delayBuffer.createCircularBuffer(bufferLength);
 	}
 
+	/** carve the delay buffer from an arena (nullptr = heap); takes effect at the next createDelayBuffer( ) */
+	void setArena(AudioArena* arena) { delayBuffer.setArena(arena); }
+
 	/** read delay at current location */
 	double readDelay()
 	{
@@ -3931,7 +5780,72 @@ public:
 		delayBuffer.writeBuffer(xn);
 	}
 
+	/** process a MONO block; same result as numSamples calls to processAudioSample( ) */
+	virtual void processAudioBlock(const double* input, double* output, uint32_t numSamples)
+	{
+		if (simpleDelayParameters.delay_Samples == 0)
+		{
+			if (output != input)
+				memcpy(output, input, numSamples * sizeof(double));
+			return;
+		}
+
+		double xn[DELAY_BLOCK_LEN];
+		uint32_t done = 0;
+		while (done < numSamples)
+		{
+			uint32_t count = getBlockLength(simpleDelayParameters.delay_Samples, numSamples - done);
+
+			// --- keep the input in case we run in place
+			memcpy(xn, input + done, count * sizeof(double));
+			readDelayBlock(output + done, count);
+			writeDelayBlock(xn, count);
+			done += count;
+		}
+	}
+
+	/** samples that can be read as one block at this delay before the next write (at most DELAY_BLOCK_LEN) */
+	uint32_t getBlockLength(double _delay_Samples, uint32_t count)
+	{
+		if (count > DELAY_BLOCK_LEN) count = DELAY_BLOCK_LEN;
+		return CircularBuffer<double>::getBlockReadLength(_delay_Samples, count, getInterpolation());
+	}
+
+	/** per-sample delay version of getBlockLength( ) */
+	uint32_t getBlockLength(const double* _delays_Samples, uint32_t count)
+	{
+		if (count > DELAY_BLOCK_LEN) count = DELAY_BLOCK_LEN;
+		return CircularBuffer<double>::getBlockReadLength(_delays_Samples, count, getInterpolation());
+	}
+
+	/** block version of readDelay( ); count must come from getBlockLength( ) */
+	void readDelayBlock(double* output, uint32_t count)
+	{
+		delayBuffer.readBlock(output, count, simpleDelayParameters.delay_Samples, getInterpolation());
+	}
+
+	/** block read with per-sample delay times in samples; count must come from getBlockLength( ) */
+	void readDelayBlockAtSamples(double* output, const double* _delays_Samples, uint32_t count)
+	{
+		delayBuffer.readBlock(output, _delays_Samples, count, getInterpolation());
+	}
+
+	/** block version of writeDelay( ) */
+	void writeDelayBlock(const double* input, uint32_t count)
+	{
+		delayBuffer.writeBlock(input, count);
+	}
+
+	/** samples per millisecond at the current sample rate */
+	double getSamplesPerMSec() { return samplesPerMSec; }
+
 private:
+	/** the buffer's interpolate flag as an interpolator */
+	delayInterpolation getInterpolation()
+	{
+		return simpleDelayParameters.interpolate ? delayInterpolation::kLinear : delayInterpolation::kNone;
+	}
+
 	SimpleDelayParameters simpleDelayParameters; ///< object parameters
 
 	double sampleRate = 0.0;		///< sample rate
@@ -4047,6 +5961,45 @@ public:
 		return yn;
 	}
 
+	/** process a MONO block; same result as numSamples calls to processAudioSample( ) */
+	virtual void processAudioBlock(const double* input, double* output, uint32_t numSamples)
+	{
+		const double delay_Samples = delay.getParameters().delay_Samples;
+		const double g2 = lpf_g*(1.0 - comb_g);
+
+		double dn[DELAY_BLOCK_LEN];
+		uint32_t done = 0;
+		while (done < numSamples)
+		{
+			uint32_t count = delay.getBlockLength(delay_Samples, numSamples - done);
+			const double* xn = input + done;
+			double* yn = output + done;
+
+			// --- form the delay inputs before the outputs overwrite them (in place)
+			double ynBlock[DELAY_BLOCK_LEN];
+			delay.readDelayBlock(ynBlock, count);
+			if (combFilterParameters.enableLPF)
+			{
+				// --- the LPF is recursive; only this loop stays scalar
+				for (uint32_t n = 0; n < count; n++)
+				{
+					double filteredSignal = ynBlock[n] + g2*lpf_state;
+					dn[n] = xn[n] + comb_g*filteredSignal;
+					lpf_state = filteredSignal;
+				}
+			}
+			else
+			{
+				for (uint32_t n = 0; n < count; n++)
+					dn[n] = xn[n] + comb_g*ynBlock[n];
+			}
+
+			memcpy(yn, ynBlock, count * sizeof(double));
+			delay.writeDelayBlock(dn, count);
+			done += count;
+		}
+	}
+
 	/** return false: this object only processes samples */
 	virtual bool canProcessAudioFrame() { return false; }
 
@@ -4092,6 +6045,9 @@ public:
 		delay.createDelayBuffer(_sampleRate, delay_mSec);
 	}
 
+	/** carve the delay buffer from an arena (nullptr = heap); takes effect at the next createDelayBuffer( ) */
+	void setArena(AudioArena* arena) { delay.setArena(arena); }
+
 private:
 	CombFilterParameters combFilterParameters; ///< object parameters
 	double sampleRate = 0.0;	///< sample rate
@@ -4241,7 +6197,7 @@ public:
 		double yn = -apf_g*wn + wnD;
 
 		// underflow check
-		checkFloatUnderflow(yn);
+		hotPathUnderflowCheck(yn);
 
 		// write delay line
 		delay.writeDelay(wn);
@@ -4249,9 +6205,77 @@ public:
 		return yn;
 	}
 
-	/** return false: this object only processes samples */
-	virtual bool canProcessAudioFrame() { return false; }
-
+	/** process a MONO block; same result as numSamples calls to processAudioSample( ) */
+	virtual void processAudioBlock(const double* input, double* output, uint32_t numSamples)
+	{
+		SimpleDelayParameters delayParams = delay.getParameters();
+		if (delayParams.delay_Samples == 0)
+		{
+			if (output != input)
+				memcpy(output, input, numSamples * sizeof(double));
+			return;
+		}
+
+		const double apf_g = delayAPFParameters.apf_g;
+		const double lpf_g = delayAPFParameters.lpf_g;
+		const double lfoDepth = delayAPFParameters.lfoDepth;
+		const double samplesPerMSec = delay.getSamplesPerMSec();
+
+		// --- modulation range; the shortest delay sets the block length
+		const double maxDelay = delayParams.delayTime_mSec;
+		const double minDelay = delayAPFParameters.enableLFO ? fmax(0.0, maxDelay - delayAPFParameters.lfoMaxModulation_mSec) : maxDelay;
+		const double minDelay_Samples = delayAPFParameters.enableLFO ? minDelay*samplesPerMSec : delayParams.delay_Samples;
+
+		double wnD[DELAY_BLOCK_LEN];
+		double wn[DELAY_BLOCK_LEN];
+		double delays[DELAY_BLOCK_LEN];
+		uint32_t done = 0;
+		while (done < numSamples)
+		{
+			uint32_t count = delay.getBlockLength(minDelay_Samples, numSamples - done);
+
+			// --- read the delay line to get w(n-D)
+			if (delayAPFParameters.enableLFO)
+			{
+				modLFO.renderModulationBlock(delays, nullptr, count);
+				for (uint32_t n = 0; n < count; n++)
+					delays[n] = samplesPerMSec*doUnipolarModulationFromMax(bipolarToUnipolar(lfoDepth*delays[n]), minDelay, maxDelay);
+				delay.readDelayBlockAtSamples(wnD, delays, count);
+			}
+			else
+				delay.readDelayBlock(wnD, count);
+
+			if (delayAPFParameters.enableLPF)
+			{
+				// --- apply simple 1st order pole LPF, overwrite wnD
+				for (uint32_t n = 0; n < count; n++)
+				{
+					wnD[n] = wnD[n]*(1.0 - lpf_g) + lpf_g*lpf_state;
+					lpf_state = wnD[n];
+				}
+			}
+
+			const double* xn = input + done;
+			double* yn = output + done;
+			for (uint32_t n = 0; n < count; n++)
+			{
+				// form w(n) = x(n) + gw(n-D) and y(n) = -gw(n) + w(n-D)
+				wn[n] = xn[n] + apf_g*wnD[n];
+				yn[n] = -apf_g*wn[n] + wnD[n];
+
+				// underflow check
+				hotPathUnderflowCheck(yn[n]);
+			}
+
+			// write delay line
+			delay.writeDelayBlock(wn, count);
+			done += count;
+		}
+	}
+
+	/** return false: this object only processes samples */
+	virtual bool canProcessAudioFrame() { return false; }
+
 	/** get parameters: note use of custom structure for passing param data */
 	/**
 	\return DelayAPFParameters custom data structure
@@ -4285,6 +6309,9 @@ public:
 		delay.createDelayBuffer(_sampleRate, delay_mSec);
 	}
 
+	/** carve the delay buffer from an arena (nullptr = heap); takes effect at the next createDelayBuffer( ) */
+	void setArena(AudioArena* arena) { delay.setArena(arena); }
+
 protected:
 	// --- component parameters
 	DelayAPFParameters delayAPFParameters;	///< obeject parameters
@@ -4443,7 +6470,7 @@ public:
 		double yn = -apf_g*wn + wnD;
 
 		// --- underflow check
-		checkFloatUnderflow(yn);
+		hotPathUnderflowCheck(yn);
 
 		// --- write delay line
 		delay.writeDelay(ynInner);
@@ -4451,6 +6478,14 @@ public:
 		return yn;
 	}
 
+	/** process a MONO block; the DelayAPF block path would skip the inner APF, so this runs the nested
+	    structure per sample (with no virtual dispatch) */
+	virtual void processAudioBlock(const double* input, double* output, uint32_t numSamples)
+	{
+		for (uint32_t i = 0; i < numSamples; i++)
+			output[i] = NestedDelayAPF::processAudioSample(input[i]);
+	}
+
 	/** get parameters: note use of custom structure for passing param data */
 	/**
 	\return BiquadParameters custom data structure
@@ -4496,6 +6531,13 @@ public:
 		nestedAPF.createDelayBuffer(_sampleRate, nestedAPFDelay_mSec);
 	}
 
+	/** carve both delay buffers from an arena (nullptr = heap); takes effect at the next createDelayBuffers( ) */
+	void setArena(AudioArena* arena)
+	{
+		DelayAPF::setArena(arena);
+		nestedAPF.setArena(arena);
+	}
+
 private:
 	NestedDelayAPFParameters nestedAPFParameters; ///< object parameters
 	DelayAPF nestedAPF;	///< nested APF object
@@ -4543,6 +6585,7 @@ The TwoBandShelvingFilter object implements two shelving filters in series in th
 
 Audio I/O:
 - Processes mono input to mono output.
+- the two shelves run as the two sections of a BiquadCascade; the AudioFilter members only calculate coefficients
 
 Control I/F:
 - Use TwoBandShelvingFilterParameters structure to get/set object params.
@@ -4564,6 +6607,8 @@ public:
 		params = highShelfFilter.getParameters();
 		params.algorithm = filterAlgorithm::kHiShelf;
 		highShelfFilter.setParameters(params);
+
+		loadShelfCoefficients();
 	}		/* C-TOR */
 
 	~TwoBandShelvingFilter() {}		/* D-TOR */
@@ -4573,6 +6618,13 @@ public:
 	{
 		lowShelfFilter.reset(_sampleRate);
 		highShelfFilter.reset(_sampleRate);
+
+		// --- reset() does not recalculate; pick up the new rate before loading the cascade
+		lowShelfFilter.setSampleRate(_sampleRate);
+		highShelfFilter.setSampleRate(_sampleRate);
+
+		shelves.reset();
+		loadShelfCoefficients();
 		return true;
 	}
 
@@ -4586,13 +6638,24 @@ public:
 	*/
 	virtual double processAudioSample(double xn)
 	{
-		// --- all modes do Full Wave Rectification
-		double filteredSignal = lowShelfFilter.processAudioSample(xn);
-		filteredSignal = highShelfFilter.processAudioSample(filteredSignal);
+		// --- section 0 = low shelf, section 1 = high shelf
+		double filteredSignal = 0.0;
+		shelves.processAudioFrame(&xn, &filteredSignal);
 
 		return filteredSignal;
 	}
 
+	/** process a block through the two filters in series; in and out may be the same buffer */
+	/**
+	\param in input buffer
+	\param out output buffer
+	\param count number of samples
+	*/
+	virtual void processAudioBlock(const double* in, double* out, uint32_t count)
+	{
+		shelves.processAudioBlock(&in, &out, count);
+	}
+
 	/** get parameters: note use of custom structure for passing param data */
 	/**
 	\return TwoBandShelvingFilterParameters custom data structure
@@ -4618,12 +6681,22 @@ public:
 		filterParams.fc = parameters.highShelf_fc;
 		filterParams.boostCut_dB = parameters.highShelfBoostCut_dB;
 		highShelfFilter.setParameters(filterParams);
+
+		loadShelfCoefficients();
 	}
 
 private:
 	TwoBandShelvingFilterParameters parameters; ///< object parameters
-	AudioFilter lowShelfFilter;					///< filter for low shelf
-	AudioFilter highShelfFilter;				///< filter for high shelf
+	AudioFilter lowShelfFilter;					///< filter for low shelf (coefficient calculation)
+	AudioFilter highShelfFilter;				///< filter for high shelf (coefficient calculation)
+	BiquadCascade<2, 1> shelves;				///< section 0 = low shelf, section 1 = high shelf
+
+	/** copy the designed coefficients into the cascade sections */
+	void loadShelfCoefficients()
+	{
+		shelves.setSectionCoefficients(0, lowShelfFilter.getCoefficients());
+		shelves.setSectionCoefficients(1, highShelfFilter.getCoefficients());
+	}
 };
 
 /**
@@ -4655,6 +6728,7 @@ Custom parameter structure for the ReverbTank object.
 struct ReverbTankParameters
 {
 	ReverbTankParameters() {}
+	ReverbTankParameters(const ReverbTankParameters& params) = default;
 	/** all FXObjects parameter objects require overloaded= operator so remember to add new entries if you add new variables. */
 	ReverbTankParameters& operator=(const ReverbTankParameters& params)	// need this override for collections to work
 	{
@@ -4741,18 +6815,22 @@ public:
 		// ---store
 		sampleRate = _sampleRate;
 
-		// ---set up preDelay
+		// --- carve all delay lines from the tank's arena; the first reset sizes it
+		arena.rewind();
+		createDelayBuffers(_sampleRate);
+		if (arena.hasOverflowed())
+		{
+			arena.prepare(arena.getBytesRequested());
+			createDelayBuffers(_sampleRate);
+		}
+
+		// ---set up preDelay; the buffers exist, so the delay resets only flush
 		preDelay.reset(_sampleRate);
-		preDelay.createDelayBuffer(_sampleRate, 100.0);
 
 		for (int i = 0; i < NUM_BRANCHES; i++)
 		{
 			branchDelays[i].reset(_sampleRate);
-			branchDelays[i].createDelayBuffer(_sampleRate, 100.0);
-
 			branchNestedAPFs[i].reset(_sampleRate);
-			branchNestedAPFs[i].createDelayBuffers(_sampleRate, 100.0, 100.0);
-
 			branchLPFs[i].reset(_sampleRate);
 		}
 		for (int i = 0; i < NUM_CHANNELS; i++)
@@ -4946,7 +7024,24 @@ public:
 
 
 private:
+	/** create every delay buffer in the arena, 100mSec each */
+	void createDelayBuffers(double _sampleRate)
+	{
+		preDelay.setArena(&arena);
+		preDelay.createDelayBuffer(_sampleRate, 100.0);
+
+		for (unsigned int i = 0; i < NUM_BRANCHES; i++)
+		{
+			branchDelays[i].setArena(&arena);
+			branchDelays[i].createDelayBuffer(_sampleRate, 100.0);
+
+			branchNestedAPFs[i].setArena(&arena);
+			branchNestedAPFs[i].createDelayBuffers(_sampleRate, 100.0, 100.0);
+		}
+	}
+
 	ReverbTankParameters parameters;				///< object parameters
+	AudioArena arena;								///< one block for all delay lines
 
 	SimpleDelay  preDelay;							///< pre delay object
 	SimpleDelay  branchDelays[NUM_BRANCHES];		///< branch delay objects
@@ -4961,6 +7056,345 @@ private:
 	double sampleRate = 0.0;	///< current sample rate
 };
 
+// --- constants for the FDN reverb
+const unsigned int FDN_NUM_LINES = NUM_BRANCHES;	///< feedback delay lines, one per SIMD lane
+const unsigned int FDN_NUM_DIFFUSERS = 2;			///< input allpass stages per line; kThick uses both, kSparse one
+
+/**
+\struct FDNLaneDelay
+\ingroup FX-Objects
+\brief
+FDNLaneDelay holds FDN_NUM_LINES integer delay lines in one interleaved buffer ([index][line]), so one frame of
+all lines is written as a single vector and the per-line reads are one gather.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+struct FDNLaneDelay
+{
+	/** create (and clear) the buffer, carved from the arena if there is one; do NOT call from realtime audio thread */
+	void create(unsigned int lengthPowerOfTwo, AudioArena* arena = nullptr)
+	{
+		wrapMask = lengthPowerOfTwo - 1;
+		if (arena)
+		{
+			ownedBuffer.reset();
+			buffer = arena->allocate<double>(lengthPowerOfTwo * FDN_NUM_LINES);
+		}
+		else
+		{
+			ownedBuffer.reset(new double[lengthPowerOfTwo * FDN_NUM_LINES]);
+			buffer = ownedBuffer.get();
+		}
+		flush();
+	}
+
+	/** clear the buffer */
+	void flush()
+	{
+		writeIndex = 0;
+		memset(&buffer[0], 0, (wrapMask + 1) * FDN_NUM_LINES * sizeof(double));
+	}
+
+	/** set a line's delay in samples (1 to buffer length) */
+	void setDelay(unsigned int line, unsigned int delayInSamples)
+	{
+		delay[line] = delayInSamples < 1 ? 1 : (delayInSamples > wrapMask + 1 ? wrapMask + 1 : delayInSamples);
+	}
+
+	/** read every line at its delay (read-before-write) */
+	inline void read(double* output)
+	{
+		for (unsigned int l = 0; l < FDN_NUM_LINES; l++)
+			output[l] = buffer[((writeIndex - delay[l]) & wrapMask) * FDN_NUM_LINES + l];
+	}
+
+	/** write one frame of all lines */
+	inline void write(const double* input)
+	{
+		memcpy(&buffer[writeIndex * FDN_NUM_LINES], input, FDN_NUM_LINES * sizeof(double));
+		writeIndex = (writeIndex + 1) & wrapMask;
+	}
+
+	double* buffer = nullptr;						///< interleaved lines, owned or carved from an arena
+	std::unique_ptr<double[]> ownedBuffer = nullptr;	///< heap buffer (no arena)
+	unsigned int wrapMask = 0;						///< buffer length - 1
+	unsigned int writeIndex = 0;					///< shared write index
+	unsigned int delay[FDN_NUM_LINES] = { 1, 1, 1, 1 };	///< per-line delay in samples
+};
+
+/**
+\class FDNReverb
+\ingroup FX-Objects
+\brief
+The FDNReverb object is a four line feedback delay network with the ReverbTank's controls, for short ambiences
+where the ReverbTank's chain of scalar objects costs too much.
+
+- the four branches run as lanes of one vector: lane-parallel input allpass diffusion, interleaved delay lines,
+  one-pole damping LPFs and per-line decay gains; the lane loops are fixed-length so the compiler emits SIMD code
+- the lines are mixed by a 4x4 Hadamard matrix (orthonormal, so the loop gain is set by the decay gains alone)
+- density: kThick diffuses through both allpass stages per line, kSparse through one
+- damping: lpf_g, the same one-pole g as the ReverbTank's branch LPFs
+- size: fixeDelayMax_mSec and fixeDelayWeight_Pct set the line lengths with the ReverbTank's fixed delay weights;
+  apfDelayMax_mSec and apfDelayWeight_Pct set the diffuser lengths
+- decay: kRT (0 to 1); the per-line gains give the same decay rate as the ReverbTank's four branch gains around its loop
+
+Audio I/O:
+- Processes mono input to mono OR stereo output; processStereoBlock( ) runs whole blocks.
+
+Control I/F:
+- Use ReverbTankParameters structure to get/set object params.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+class FDNReverb : public IAudioSignalProcessor
+{
+public:
+	FDNReverb() {}		/* C-TOR */
+	~FDNReverb() {}		/* D-TOR */
+
+	/** reset members to initialized state */
+	virtual bool reset(double _sampleRate)
+	{
+		if (sampleRate != _sampleRate || !lines.buffer)
+		{
+			sampleRate = _sampleRate;
+
+			// --- carve all lines from the reverb's arena; the first reset sizes it
+			arena.rewind();
+			createDelayLines();
+			if (arena.hasOverflowed())
+			{
+				arena.prepare(arena.getBytesRequested());
+				createDelayLines();
+			}
+			preDelay.reset(_sampleRate);
+		}
+		else
+		{
+			preDelay.reset(_sampleRate);
+			lines.flush();
+			for (unsigned int s = 0; s < FDN_NUM_DIFFUSERS; s++)
+				diffusers[s].flush();
+		}
+
+		memset(lpfState, 0, sizeof(lpfState));
+		for (unsigned int i = 0; i < NUM_CHANNELS; i++)
+			shelvingFilters[i].reset(_sampleRate);
+
+		updateDelays();
+		return true;
+	}
+
+	/** return true: this object can process frames */
+	virtual bool canProcessAudioFrame() { return true; }
+
+	/** process mono reverb */
+	/**
+	\param xn input
+	\return the processed sample
+	*/
+	virtual double processAudioSample(double xn)
+	{
+		double outL = 0.0;
+		double outR = 0.0;
+		processTank(xn, outL, outR);
+		return dryMix*xn + wetMix*(0.5*outL + 0.5*outR);
+	}
+
+	/** process stereo reverb */
+	virtual bool processAudioFrame(const float* inputFrame,
+		float* outputFrame,
+		uint32_t inputChannels,
+		uint32_t outputChannels)
+	{
+		if (inputChannels == 0 || outputChannels == 0)
+			return false;
+
+		// --- mono-ized input signal
+		double xnL = inputFrame[0];
+		double xnR = inputChannels > 1 ? inputFrame[1] : 0.0;
+		double monoXn = double(1.0 / inputChannels)*xnL + double(1.0 / inputChannels)*xnR;
+
+		double tankOutL = 0.0;
+		double tankOutR = 0.0;
+		processTank(monoXn, tankOutL, tankOutR);
+
+		if (outputChannels == 1)
+			outputFrame[0] = dryMix*xnL + wetMix*(0.5*tankOutL + 0.5*tankOutR);
+		else
+		{
+			outputFrame[0] = dryMix*xnL + wetMix*tankOutL;
+			outputFrame[1] = dryMix*xnR + wetMix*tankOutR;
+		}
+		return true;
+	}
+
+	/** process a stereo block; outputs may alias inputs */
+	void processStereoBlock(const double* inputL, const double* inputR, double* outputL, double* outputR, uint32_t numSamples)
+	{
+		for (uint32_t n = 0; n < numSamples; n++)
+		{
+			double xnL = inputL[n];
+			double xnR = inputR[n];
+			double tankOutL = 0.0;
+			double tankOutR = 0.0;
+			processTank(0.5*xnL + 0.5*xnR, tankOutL, tankOutR);
+
+			outputL[n] = dryMix*xnL + wetMix*tankOutL;
+			outputR[n] = dryMix*xnR + wetMix*tankOutR;
+		}
+	}
+
+	/** get parameters: note use of custom structure for passing param data */
+	/**
+	\return ReverbTankParameters custom data structure
+	*/
+	ReverbTankParameters getParameters() { return parameters; }
+
+	/** set parameters: note use of custom structure for passing param data */
+	/**
+	\param ReverbTankParameters custom data structure
+	*/
+	void setParameters(const ReverbTankParameters& params)
+	{
+		TwoBandShelvingFilterParameters filterParams = shelvingFilters[0].getParameters();
+		filterParams.highShelf_fc = params.highShelf_fc;
+		filterParams.highShelfBoostCut_dB = params.highShelfBoostCut_dB;
+		filterParams.lowShelf_fc = params.lowShelf_fc;
+		filterParams.lowShelfBoostCut_dB = params.lowShelfBoostCut_dB;
+		shelvingFilters[0].setParameters(filterParams);
+		shelvingFilters[1].setParameters(filterParams);
+
+		SimpleDelayParameters delayParams = preDelay.getParameters();
+		delayParams.delayTime_mSec = params.preDelayTime_mSec;
+		preDelay.setParameters(delayParams);
+
+		dryMix = pow(10.0, params.dryLevel_dB / 20.0);
+		wetMix = pow(10.0, params.wetLevel_dB / 20.0);
+
+		parameters = params;
+		updateDelays();
+	}
+
+protected:
+	/** one sample through the network; returns the shelved LEFT and RIGHT tank outputs */
+	inline void processTank(double xn, double& outL, double& outR)
+	{
+		const double x = preDelay.processAudioSample(xn);
+		const double lpf_g = parameters.lpf_g;
+
+		// --- input diffusion: lane-parallel delaying APFs; w(n) = x(n) + g w(n-D), y(n) = -g w(n) + w(n-D)
+		double lanes[FDN_NUM_LINES];
+		for (unsigned int l = 0; l < FDN_NUM_LINES; l++)
+			lanes[l] = x;
+
+		const unsigned int numDiffusers = parameters.density == reverbDensity::kThick ? FDN_NUM_DIFFUSERS : 1;
+		for (unsigned int s = 0; s < numDiffusers; s++)
+		{
+			double wnD[FDN_NUM_LINES];
+			double wn[FDN_NUM_LINES];
+			const double apf_g = diffuserGain[s];
+			diffusers[s].read(wnD);
+			for (unsigned int l = 0; l < FDN_NUM_LINES; l++)
+			{
+				wn[l] = lanes[l] + apf_g*wnD[l];
+				lanes[l] = -apf_g*wn[l] + wnD[l];
+			}
+			diffusers[s].write(wn);
+		}
+
+		// --- line outputs, then damping and decay
+		double sn[FDN_NUM_LINES];
+		double damped[FDN_NUM_LINES];
+		lines.read(sn);
+		for (unsigned int l = 0; l < FDN_NUM_LINES; l++)
+		{
+			lpfState[l] = (1.0 - lpf_g)*sn[l] + lpf_g*lpfState[l];
+			hotPathUnderflowCheck(lpfState[l]);
+			damped[l] = lineGain[l]*lpfState[l];
+		}
+
+		// --- Hadamard mix as two butterfly stages, scaled by 1/2 to stay orthonormal
+		const double a = damped[0] + damped[1];
+		const double b = damped[0] - damped[1];
+		const double c = damped[2] + damped[3];
+		const double d = damped[2] - damped[3];
+		double feedback[FDN_NUM_LINES] = { 0.5*(a + c), 0.5*(b + d), 0.5*(a - c), 0.5*(b - d) };
+
+		for (unsigned int l = 0; l < FDN_NUM_LINES; l++)
+			feedback[l] += lanes[l];
+		lines.write(feedback);
+
+		// --- two orthogonal output taps (Hadamard rows), shelved per channel
+		outL = shelvingFilters[0].processAudioSample(0.5*(sn[0] + sn[1] - sn[2] - sn[3]));
+		outR = shelvingFilters[1].processAudioSample(0.5*(sn[0] - sn[1] - sn[2] + sn[3]));
+	}
+
+	/** line and diffuser lengths and the per-line decay gains */
+	void updateDelays()
+	{
+		if (sampleRate <= 0.0 || !lines.buffer)
+			return;
+
+		const double samplesPerMSec = sampleRate / 1000.0;
+		const double globalAPFMaxDelay = (parameters.apfDelayWeight_Pct / 100.0)*parameters.apfDelayMax_mSec;
+		const double globalFixedMaxDelay = (parameters.fixeDelayWeight_Pct / 100.0)*parameters.fixeDelayMax_mSec;
+
+		// --- the ReverbTank's loop runs through every branch's fixed delay and nested APFs
+		double totalDelay = 0.0;
+		for (unsigned int l = 0; l < FDN_NUM_LINES; l++)
+		{
+			for (unsigned int s = 0; s < FDN_NUM_DIFFUSERS; s++)
+			{
+				diffusers[s].setDelay(l, (unsigned int)(globalAPFMaxDelay*apfDelayWeight[2 * l + s]*samplesPerMSec));
+				totalDelay += diffusers[s].delay[l];
+			}
+
+			lines.setDelay(l, (unsigned int)(globalFixedMaxDelay*fixedDelayWeight[l]*samplesPerMSec));
+			totalDelay += lines.delay[l];
+		}
+
+		// --- it applies kRT once per branch, NUM_BRANCHES times around that loop; spread the same decay
+		//     rate over each line's length
+		const double kRT = fmax(parameters.kRT, 0.0);
+		for (unsigned int l = 0; l < FDN_NUM_LINES; l++)
+			lineGain[l] = pow(kRT, FDN_NUM_LINES * lines.delay[l] / totalDelay);
+	}
+
+	/** create the pre-delay, lines and diffusers in the arena; 100mSec maximum for every line, same as the ReverbTank */
+	void createDelayLines()
+	{
+		preDelay.setArena(&arena);
+		preDelay.createDelayBuffer(sampleRate, 100.0);
+
+		unsigned int length = (unsigned int)(pow(2, ceil(log(0.1 * sampleRate + 1.0) / log(2))));
+		lines.create(length, &arena);
+		for (unsigned int s = 0; s < FDN_NUM_DIFFUSERS; s++)
+			diffusers[s].create(length, &arena);
+	}
+
+	ReverbTankParameters parameters;				///< object parameters
+	AudioArena arena;								///< one block for the pre-delay, lines and diffusers
+	double sampleRate = 0.0;						///< current sample rate
+	double dryMix = 0.707;							///< dry output level
+	double wetMix = 0.707;							///< wet output level
+
+	SimpleDelay preDelay;							///< pre delay object
+	FDNLaneDelay diffusers[FDN_NUM_DIFFUSERS];		///< input allpass delay lines
+	FDNLaneDelay lines;								///< feedback delay lines
+	double lpfState[FDN_NUM_LINES] = { 0.0 };		///< damping LPF state per line
+	double lineGain[FDN_NUM_LINES] = { 0.0 };		///< decay gain per line
+	TwoBandShelvingFilter shelvingFilters[NUM_CHANNELS]; ///< shelving filters 0 = left; 1 = right
+
+	double diffuserGain[FDN_NUM_DIFFUSERS] = { 0.5, -0.5 };	///< APF g per diffuser stage, as the ReverbTank's outer/inner APFs
+	double apfDelayWeight[FDN_NUM_LINES * 2] = { 0.317, 0.873, 0.477, 0.291, 0.993, 0.757, 0.179, 0.575 };///< ReverbTank APF delay weights
+	double fixedDelayWeight[FDN_NUM_LINES] = { 1.0, 0.873, 0.707, 0.667 };	///< ReverbTank fixed delay weights
+};
+
 
 /**
 \class PeakLimiter
@@ -8128,6 +10562,7 @@ Custom parameter structure for the WDF filter examples.
 struct WDFParameters
 {
 	WDFParameters() {}
+	WDFParameters(const WDFParameters& params) = default;
 	/** all FXObjects parameter objects require overloaded= operator so remember to add new entries if you add new variables. */
 	WDFParameters& operator=(const WDFParameters& params)
 	{
@@ -8566,69 +11001,1478 @@ public:
 		return 0.5*parallelTerminatedAdaptor_LC.getOutput2();
 	}
 
-	/** create WDF structure */
-	void createWDF()
+	/** create WDF structure */
+	void createWDF()
+	{
+		// --- create components, init to noramlized values fc =
+		//	   initial values for fc = 1kHz Q = 0.707
+		//     Holding C Constant at 1e-6
+		//			   L = 2.533e-2
+		//			   R = 2.251131 e2
+		seriesAdaptor_R.setComponent(wdfComponent::R, 2.533e-2);
+		parallelTerminatedAdaptor_LC.setComponent(wdfComponent::seriesLC, 2.533e-2, 1.0e-6);
+
+		// --- connect adapters
+		WdfAdaptorBase::connectAdaptors(&seriesAdaptor_R, &parallelTerminatedAdaptor_LC);
+
+		// --- set source resistance
+		seriesAdaptor_R.setSourceResistance(0.0); // --- Rs = 600
+
+		// --- set open ckt termination
+		parallelTerminatedAdaptor_LC.setOpenTerminalResistance(true);
+	}
+
+	/** get parameters: note use of custom structure for passing param data */
+	/**
+	\return WDFParameters custom data structure
+	*/
+	WDFParameters getParameters() { return wdfParameters; }
+
+	/** set parameters: note use of custom structure for passing param data */
+	/**
+	\param WDFParameters custom data structure
+	*/
+	void setParameters(const WDFParameters& _wdfParameters)
+	{
+		if (_wdfParameters.fc != wdfParameters.fc ||
+			_wdfParameters.Q != wdfParameters.Q ||
+			_wdfParameters.boostCut_dB != wdfParameters.boostCut_dB ||
+			_wdfParameters.frequencyWarping != wdfParameters.frequencyWarping)
+		{
+			wdfParameters = _wdfParameters;
+			double fc_Hz = wdfParameters.fc;
+
+			if (wdfParameters.frequencyWarping)
+			{
+				double arg = (kPi*fc_Hz) / sampleRate;
+				fc_Hz = fc_Hz*(tan(arg) / arg);
+			}
+
+			double inductorValue = 1.0 / (1.0e-6 * pow((2.0*kPi*fc_Hz), 2.0));
+			double resistorValue = (1.0 / wdfParameters.Q)*(pow(inductorValue / 1.0e-6, 0.5));
+
+			seriesAdaptor_R.setComponentValue(resistorValue);
+			parallelTerminatedAdaptor_LC.setComponentValue_LC(inductorValue, 1.0e-6);
+		}
+	}
+
+protected:
+	WDFParameters wdfParameters;	///< object parameters
+
+	// --- adapters
+	WdfSeriesAdaptor				seriesAdaptor_R; ///< adaptor for series R
+	WdfParallelTerminatedAdaptor	parallelTerminatedAdaptor_LC; ///< adaptor for parallel LC
+
+	double sampleRate = 1.0; ///< sample rate storage
+};
+
+
+// ------------------------------------------------------------------ //
+// --- STATIC WDF LIBRARY ------------------------------------------- //
+// ------------------------------------------------------------------ //
+
+/**
+\class WdfStaticResistor
+\ingroup WDF-Objects
+\brief
+The WdfStaticResistor object is the value-type resistor for the static (template) WDF library.
+
+The static library mirrors the WDF library above, but a ladder is a single type: each adaptor owns
+its component and its downstream adaptor by value, so there are no virtual calls and no pointers to follow.
+Components expose the same getOutput( ) (reflected wave) / setInput( ) (incident wave) pair as
+the IComponentAdaptor versions, but non-virtually, so the per-sample traversal inlines.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+class WdfStaticResistor
+{
+public:
+	/** set the sample rate and flush state */
+	void reset(double _sampleRate) { sampleRate = _sampleRate; }
+
+	/** set the resistance in ohms; the adaptor chain must be re-initialized afterwards */
+	void setComponentValue(double _componentValue) { componentValue = _componentValue; }
+
+	/** get the port resistance */
+	double getComponentResistance() { return componentValue; }
+
+	/** get the port conductance */
+	double getComponentConductance() { return 1.0 / componentValue; }
+
+	/** reflected wave: a matched resistor reflects nothing */
+	inline double getOutput() { return 0.0; }
+
+	/** incident wave */
+	inline void setInput(double) {}
+
+	/** no state registers */
+	static const uint32_t numRegisters = 0;
+	void getRegisters(double*) {}
+	void setRegisters(const double*) {}
+
+protected:
+	double componentValue = 0.0;	///< resistance in ohms
+	double sampleRate = 0.0;		///< sample rate
+};
+
+/**
+\class WdfStaticCapacitor
+\ingroup WDF-Objects
+\brief
+The WdfStaticCapacitor object is the value-type capacitor for the static WDF library; see WdfStaticResistor.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+class WdfStaticCapacitor
+{
+public:
+	/** set the sample rate and flush state */
+	void reset(double _sampleRate) { sampleRate = _sampleRate; updateComponentResistance(); zRegister = 0.0; }
+
+	/** set the capacitance in farads; the adaptor chain must be re-initialized afterwards */
+	void setComponentValue(double _componentValue) { componentValue = _componentValue; updateComponentResistance(); }
+
+	/** get the port resistance */
+	double getComponentResistance() { return componentResistance; }
+
+	/** get the port conductance */
+	double getComponentConductance() { return 1.0 / componentResistance; }
+
+	/** reflected wave: z^-1 */
+	inline double getOutput() { return zRegister; }
+
+	/** incident wave */
+	inline void setInput(double in) { zRegister = in; }
+
+	/** state registers, for WdfStaticStateSpace */
+	static const uint32_t numRegisters = 1;
+	void getRegisters(double* registers) { registers[0] = zRegister; }
+	void setRegisters(const double* registers) { zRegister = registers[0]; }
+
+protected:
+	double zRegister = 0.0;				///< storage register
+	double componentValue = 0.0;		///< capacitance in farads
+	double componentResistance = 0.0;	///< simulated resistance
+	double sampleRate = 0.0;			///< sample rate
+
+	/** R = 1/(2Cfs) */
+	void updateComponentResistance() { componentResistance = 1.0 / (2.0*componentValue*sampleRate); }
+};
+
+/**
+\class WdfStaticInductor
+\ingroup WDF-Objects
+\brief
+The WdfStaticInductor object is the value-type inductor for the static WDF library; see WdfStaticResistor.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+class WdfStaticInductor
+{
+public:
+	/** set the sample rate and flush state */
+	void reset(double _sampleRate) { sampleRate = _sampleRate; updateComponentResistance(); zRegister = 0.0; }
+
+	/** set the inductance in henries; the adaptor chain must be re-initialized afterwards */
+	void setComponentValue(double _componentValue) { componentValue = _componentValue; updateComponentResistance(); }
+
+	/** get the port resistance */
+	double getComponentResistance() { return componentResistance; }
+
+	/** get the port conductance */
+	double getComponentConductance() { return 1.0 / componentResistance; }
+
+	/** reflected wave: -z^-1 */
+	inline double getOutput() { return -zRegister; }
+
+	/** incident wave */
+	inline void setInput(double in) { zRegister = in; }
+
+	/** state registers, for WdfStaticStateSpace */
+	static const uint32_t numRegisters = 1;
+	void getRegisters(double* registers) { registers[0] = zRegister; }
+	void setRegisters(const double* registers) { zRegister = registers[0]; }
+
+protected:
+	double zRegister = 0.0;				///< storage register
+	double componentValue = 0.0;		///< inductance in henries
+	double componentResistance = 0.0;	///< simulated resistance
+	double sampleRate = 0.0;			///< sample rate
+
+	/** R = 2Lfs */
+	void updateComponentResistance() { componentResistance = 2.0*componentValue*sampleRate; }
+};
+
+/**
+\class WdfStaticSeriesLC
+\ingroup WDF-Objects
+\brief
+The WdfStaticSeriesLC object is the value-type series LC pair for the static WDF library; it uses
+the same port resistance and scattering as WdfSeriesLC, with the scattering coefficient calculated
+when the values change rather than per sample.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+class WdfStaticSeriesLC
+{
+public:
+	/** set the sample rate and flush state */
+	void reset(double _sampleRate) { sampleRate = _sampleRate; updateComponentResistance(); zRegister_L = 0.0; zRegister_C = 0.0; }
+
+	/** set the values in henries and farads; the adaptor chain must be re-initialized afterwards */
+	void setComponentValue_LC(double _componentValue_L, double _componentValue_C)
+	{
+		componentValue_L = _componentValue_L;
+		componentValue_C = _componentValue_C;
+		updateComponentResistance();
+	}
+
+	/** get the port resistance */
+	double getComponentResistance() { return componentResistance; }
+
+	/** get the port conductance */
+	double getComponentConductance() { return 1.0 / componentResistance; }
+
+	/** reflected wave */
+	inline double getOutput() { return zRegister_L; }
+
+	/** incident wave */
+	inline void setInput(double in)
+	{
+		double N1 = K*(in - zRegister_L);
+		zRegister_L = N1 + zRegister_C;
+		zRegister_C = in;
+	}
+
+	/** state registers, for WdfStaticStateSpace */
+	static const uint32_t numRegisters = 2;
+	void getRegisters(double* registers) { registers[0] = zRegister_L; registers[1] = zRegister_C; }
+	void setRegisters(const double* registers) { zRegister_L = registers[0]; zRegister_C = registers[1]; }
+
+protected:
+	double zRegister_L = 0.0;			///< storage register for L
+	double zRegister_C = 0.0;			///< storage register for C
+	double componentValue_L = 0.0;		///< component value L
+	double componentValue_C = 0.0;		///< component value C
+	double RL = 0.0;					///< RL value
+	double RC = 0.0;					///< RC value
+	double K = 0.0;						///< scattering coefficient
+	double componentResistance = 0.0;	///< equivalent resistance of pair of components
+	double sampleRate = 0.0;			///< sample rate
+
+	/** port resistance and scattering coefficient, as WdfSeriesLC */
+	void updateComponentResistance()
+	{
+		RL = 2.0*componentValue_L*sampleRate;
+		RC = 1.0 / (2.0*componentValue_C*sampleRate);
+		componentResistance = RL + (1.0 / RC);
+
+		double YC = 1.0 / RC;
+		K = (1.0 - RL*YC) / (1.0 + RL*YC);
+	}
+};
+
+/**
+\class WdfStaticParallelLC
+\ingroup WDF-Objects
+\brief
+The WdfStaticParallelLC object is the value-type parallel LC pair for the static WDF library; see WdfStaticSeriesLC.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+class WdfStaticParallelLC
+{
+public:
+	/** set the sample rate and flush state */
+	void reset(double _sampleRate) { sampleRate = _sampleRate; updateComponentResistance(); zRegister_L = 0.0; zRegister_C = 0.0; }
+
+	/** set the values in henries and farads; the adaptor chain must be re-initialized afterwards */
+	void setComponentValue_LC(double _componentValue_L, double _componentValue_C)
+	{
+		componentValue_L = _componentValue_L;
+		componentValue_C = _componentValue_C;
+		updateComponentResistance();
+	}
+
+	/** get the port resistance */
+	double getComponentResistance() { return componentResistance; }
+
+	/** get the port conductance */
+	double getComponentConductance() { return 1.0 / componentResistance; }
+
+	/** reflected wave */
+	inline double getOutput() { return -zRegister_L; }
+
+	/** incident wave */
+	inline void setInput(double in)
+	{
+		double N1 = K*(in - zRegister_L);
+		zRegister_L = N1 + zRegister_C;
+		zRegister_C = in;
+	}
+
+	/** state registers, for WdfStaticStateSpace */
+	static const uint32_t numRegisters = 2;
+	void getRegisters(double* registers) { registers[0] = zRegister_L; registers[1] = zRegister_C; }
+	void setRegisters(const double* registers) { zRegister_L = registers[0]; zRegister_C = registers[1]; }
+
+protected:
+	double zRegister_L = 0.0;			///< storage register for L
+	double zRegister_C = 0.0;			///< storage register for C
+	double componentValue_L = 0.0;		///< component value L
+	double componentValue_C = 0.0;		///< component value C
+	double RL = 0.0;					///< RL value
+	double RC = 0.0;					///< RC value
+	double K = 0.0;						///< scattering coefficient
+	double componentResistance = 0.0;	///< equivalent resistance of pair of components
+	double sampleRate = 0.0;			///< sample rate
+
+	/** port resistance and scattering coefficient, as WdfParallelLC */
+	void updateComponentResistance()
+	{
+		RL = 2.0*componentValue_L*sampleRate;
+		RC = 1.0 / (2.0*componentValue_C*sampleRate);
+		componentResistance = (RC + 1.0 / RL);
+
+		double YL = 1.0 / RL;
+		K = (YL*RC - 1.0) / (YL*RC + 1.0);
+	}
+};
+
+/**
+\class WdfStaticSeriesRL
+\ingroup WDF-Objects
+\brief
+The WdfStaticSeriesRL object is the value-type series RL pair for the static WDF library; see WdfSeriesRL.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+class WdfStaticSeriesRL
+{
+public:
+	/** set the sample rate and flush state */
+	void reset(double _sampleRate) { sampleRate = _sampleRate; updateComponentResistance(); zRegister_L = 0.0; zRegister_C = 0.0; }
+
+	/** set the values in ohms and henries; the adaptor chain must be re-initialized afterwards */
+	void setComponentValue_RL(double _componentValue_R, double _componentValue_L)
+	{
+		componentValue_L = _componentValue_L;
+		componentValue_R = _componentValue_R;
+		updateComponentResistance();
+	}
+
+	/** get the port resistance */
+	double getComponentResistance() { return componentResistance; }
+
+	/** get the port conductance */
+	double getComponentConductance() { return 1.0 / componentResistance; }
+
+	/** reflected wave */
+	inline double getOutput()
+	{
+		double NL = -zRegister_L;
+		double out = NL*(1.0 - K) - K*zRegister_C;
+		zRegister_C = out;
+		return out;
+	}
+
+	/** incident wave */
+	inline void setInput(double in) { zRegister_L = in; }
+
+	/** state registers, for WdfStaticStateSpace */
+	static const uint32_t numRegisters = 2;
+	void getRegisters(double* registers) { registers[0] = zRegister_L; registers[1] = zRegister_C; }
+	void setRegisters(const double* registers) { zRegister_L = registers[0]; zRegister_C = registers[1]; }
+
+protected:
+	double zRegister_L = 0.0;			///< storage register for L
+	double zRegister_C = 0.0;			///< storage register for the reflected wave
+	double componentValue_L = 0.0;		///< component value L
+	double componentValue_R = 0.0;		///< component value R
+	double RL = 0.0;					///< RL value
+	double RR = 0.0;					///< RR value
+	double K = 0.0;						///< scattering coefficient
+	double componentResistance = 0.0;	///< equivalent resistance of pair of components
+	double sampleRate = 0.0;			///< sample rate
+
+	/** port resistance and scattering coefficient, as WdfSeriesRL */
+	void updateComponentResistance()
+	{
+		RR = componentValue_R;
+		RL = 2.0*componentValue_L*sampleRate;
+		componentResistance = RR + RL;
+		K = RR / componentResistance;
+	}
+};
+
+/**
+\class WdfStaticParallelRL
+\ingroup WDF-Objects
+\brief
+The WdfStaticParallelRL object is the value-type parallel RL pair for the static WDF library; see WdfParallelRL.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+class WdfStaticParallelRL
+{
+public:
+	/** set the sample rate and flush state */
+	void reset(double _sampleRate) { sampleRate = _sampleRate; updateComponentResistance(); zRegister_L = 0.0; zRegister_C = 0.0; }
+
+	/** set the values in ohms and henries; the adaptor chain must be re-initialized afterwards */
+	void setComponentValue_RL(double _componentValue_R, double _componentValue_L)
+	{
+		componentValue_L = _componentValue_L;
+		componentValue_R = _componentValue_R;
+		updateComponentResistance();
+	}
+
+	/** get the port resistance */
+	double getComponentResistance() { return componentResistance; }
+
+	/** get the port conductance */
+	double getComponentConductance() { return 1.0 / componentResistance; }
+
+	/** reflected wave */
+	inline double getOutput()
+	{
+		double NL = -zRegister_L;
+		double out = NL*(1.0 - K) + K*zRegister_C;
+		zRegister_C = out;
+		return out;
+	}
+
+	/** incident wave */
+	inline void setInput(double in) { zRegister_L = in; }
+
+	/** state registers, for WdfStaticStateSpace */
+	static const uint32_t numRegisters = 2;
+	void getRegisters(double* registers) { registers[0] = zRegister_L; registers[1] = zRegister_C; }
+	void setRegisters(const double* registers) { zRegister_L = registers[0]; zRegister_C = registers[1]; }
+
+protected:
+	double zRegister_L = 0.0;			///< storage register for L
+	double zRegister_C = 0.0;			///< storage register for the reflected wave
+	double componentValue_L = 0.0;		///< component value L
+	double componentValue_R = 0.0;		///< component value R
+	double RL = 0.0;					///< RL value
+	double RR = 0.0;					///< RR value
+	double K = 0.0;						///< scattering coefficient
+	double componentResistance = 0.0;	///< equivalent resistance of pair of components
+	double sampleRate = 0.0;			///< sample rate
+
+	/** port resistance and scattering coefficient, as WdfParallelRL */
+	void updateComponentResistance()
+	{
+		RR = componentValue_R;
+		RL = 2.0*componentValue_L*sampleRate;
+		componentResistance = 1.0 / ((1.0 / RR) + (1.0 / RL));
+		K = componentResistance / RR;
+	}
+};
+
+/**
+\class WdfStaticSeriesRC
+\ingroup WDF-Objects
+\brief
+The WdfStaticSeriesRC object is the value-type series RC pair for the static WDF library; see WdfSeriesRC.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+class WdfStaticSeriesRC
+{
+public:
+	/** set the sample rate and flush state */
+	void reset(double _sampleRate) { sampleRate = _sampleRate; updateComponentResistance(); zRegister_L = 0.0; zRegister_C = 0.0; }
+
+	/** set the values in ohms and farads; the adaptor chain must be re-initialized afterwards */
+	void setComponentValue_RC(double _componentValue_R, double _componentValue_C)
+	{
+		componentValue_R = _componentValue_R;
+		componentValue_C = _componentValue_C;
+		updateComponentResistance();
+	}
+
+	/** get the port resistance */
+	double getComponentResistance() { return componentResistance; }
+
+	/** get the port conductance */
+	double getComponentConductance() { return 1.0 / componentResistance; }
+
+	/** reflected wave */
+	inline double getOutput()
+	{
+		double NL = zRegister_L;
+		double out = NL*(1.0 - K) + K*zRegister_C;
+		zRegister_C = out;
+		return out;
+	}
+
+	/** incident wave */
+	inline void setInput(double in) { zRegister_L = in; }
+
+	/** state registers, for WdfStaticStateSpace */
+	static const uint32_t numRegisters = 2;
+	void getRegisters(double* registers) { registers[0] = zRegister_L; registers[1] = zRegister_C; }
+	void setRegisters(const double* registers) { zRegister_L = registers[0]; zRegister_C = registers[1]; }
+
+protected:
+	double zRegister_L = 0.0;			///< storage register for C
+	double zRegister_C = 0.0;			///< storage register for the reflected wave
+	double componentValue_R = 0.0;		///< component value R
+	double componentValue_C = 0.0;		///< component value C
+	double RR = 0.0;					///< RR value
+	double RC = 0.0;					///< RC value
+	double K = 0.0;						///< scattering coefficient
+	double componentResistance = 0.0;	///< equivalent resistance of pair of components
+	double sampleRate = 0.0;			///< sample rate
+
+	/** port resistance and scattering coefficient, as WdfSeriesRC */
+	void updateComponentResistance()
+	{
+		RR = componentValue_R;
+		RC = 1.0 / (2.0*componentValue_C*sampleRate);
+		componentResistance = RR + RC;
+		K = RR / componentResistance;
+	}
+};
+
+/**
+\class WdfStaticParallelRC
+\ingroup WDF-Objects
+\brief
+The WdfStaticParallelRC object is the value-type parallel RC pair for the static WDF library; see WdfParallelRC.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+class WdfStaticParallelRC
+{
+public:
+	/** set the sample rate and flush state */
+	void reset(double _sampleRate) { sampleRate = _sampleRate; updateComponentResistance(); zRegister_L = 0.0; zRegister_C = 0.0; }
+
+	/** set the values in ohms and farads; the adaptor chain must be re-initialized afterwards */
+	void setComponentValue_RC(double _componentValue_R, double _componentValue_C)
+	{
+		componentValue_R = _componentValue_R;
+		componentValue_C = _componentValue_C;
+		updateComponentResistance();
+	}
+
+	/** get the port resistance */
+	double getComponentResistance() { return componentResistance; }
+
+	/** get the port conductance */
+	double getComponentConductance() { return 1.0 / componentResistance; }
+
+	/** reflected wave */
+	inline double getOutput()
+	{
+		double NL = zRegister_L;
+		double out = NL*(1.0 - K) - K*zRegister_C;
+		zRegister_C = out;
+		return out;
+	}
+
+	/** incident wave */
+	inline void setInput(double in) { zRegister_L = in; }
+
+	/** state registers, for WdfStaticStateSpace */
+	static const uint32_t numRegisters = 2;
+	void getRegisters(double* registers) { registers[0] = zRegister_L; registers[1] = zRegister_C; }
+	void setRegisters(const double* registers) { zRegister_L = registers[0]; zRegister_C = registers[1]; }
+
+protected:
+	double zRegister_L = 0.0;			///< storage register for C
+	double zRegister_C = 0.0;			///< storage register for the reflected wave
+	double componentValue_R = 0.0;		///< component value R
+	double componentValue_C = 0.0;		///< component value C
+	double RR = 0.0;					///< RR value
+	double RC = 0.0;					///< RC value
+	double K = 0.0;						///< scattering coefficient
+	double componentResistance = 0.0;	///< equivalent resistance of pair of components
+	double sampleRate = 0.0;			///< sample rate
+
+	/** port resistance and scattering coefficient, as WdfParallelRC */
+	void updateComponentResistance()
+	{
+		RR = componentValue_R;
+		RC = 1.0 / (2.0*componentValue_C*sampleRate);
+		componentResistance = 1.0 / ((1.0 / RR) + (1.0 / RC));
+		K = componentResistance / RR;
+	}
+};
+
+/**
+\class WdfStaticSeriesAdaptor
+\ingroup WDF-Objects
+\brief
+The WdfStaticSeriesAdaptor object implements the series reflection-free (non-terminated) adaptor of the static WDF library.
+
+The adaptor owns the Component on port 3 and the Next adaptor on port 2 by value, so a ladder is one
+nested type, e.g. WdfStaticSeriesAdaptor<WdfStaticInductor, WdfStaticParallelTerminatedAdaptor<WdfStaticCapacitor>>.
+
+- initializeAdaptorChain( ) computes the port resistances and scattering coefficients down the chain;
+  call it after reset( ) and after any component value change
+- process( ) pushes one sample in at port 1 and returns the wave reflected back out of port 1;
+  the whole traversal (down to the terminated adaptor and back) inlines
+- getTerminalOutput( ) is the terminated adaptor's port-2 output, i.e. y(n)
+
+The arithmetic is identical to WdfSeriesAdaptor.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+template <typename Component, typename Next>
+class WdfStaticSeriesAdaptor
+{
+public:
+	/** reset the components down the chain */
+	void reset(double _sampleRate)
+	{
+		component.reset(_sampleRate);
+		next.reset(_sampleRate);
+	}
+
+	/** set the input (source) resistance; only used by the first adaptor in the chain */
+	void setSourceResistance(double _sourceResistance) { sourceResistance = _sourceResistance; }
+
+	/** initialize the chain of adaptors from this one downstream */
+	void initializeAdaptorChain() { initialize(sourceResistance); }
+
+	/** calculate the coefficient for port 1 resistance R1, then pass R2 downstream */
+	void initialize(double R1)
+	{
+		double componentResistance = component.getComponentResistance();
+		B = R1 / (R1 + componentResistance);
+		next.initialize(R1 + componentResistance);
+	}
+
+	/** scatter: wave in at port 1, returns the wave reflected out of port 1 */
+	inline double process(double in1)
+	{
+		double N2 = component.getOutput();
+		double in2 = next.process(-(in1 + N2));
+
+		component.setInput(-(in1 - B*(in1 + N2 + in2) + in2));
+		return in1 - B*(N2 + in2);
+	}
+
+	/** y(n) at the end of the chain */
+	inline double getTerminalOutput() { return next.getTerminalOutput(); }
+
+	/** the component on port 3 */
+	Component& getComponent() { return component; }
+
+	/** the adaptor on port 2 */
+	Next& getNext() { return next; }
+
+	/** state registers down the chain, for WdfStaticStateSpace */
+	static const uint32_t numRegisters = Component::numRegisters + Next::numRegisters;
+	void getRegisters(double* registers)
+	{
+		component.getRegisters(registers);
+		next.getRegisters(registers + Component::numRegisters);
+	}
+	void setRegisters(const double* registers)
+	{
+		component.setRegisters(registers);
+		next.setRegisters(registers + Component::numRegisters);
+	}
+
+protected:
+	Component component;			///< component on port 3
+	Next next;						///< downstream adaptor on port 2
+	double B = 0.0;					///< B coefficient value
+	double sourceResistance = 600.0;///< source impedance; OK for this to be set to 0.0 for Rs = 0
+};
+
+/**
+\class WdfStaticParallelAdaptor
+\ingroup WDF-Objects
+\brief
+The WdfStaticParallelAdaptor object implements the parallel reflection-free (non-terminated) adaptor of the
+static WDF library; see WdfStaticSeriesAdaptor. The arithmetic is identical to WdfParallelAdaptor.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+template <typename Component, typename Next>
+class WdfStaticParallelAdaptor
+{
+public:
+	/** reset the components down the chain */
+	void reset(double _sampleRate)
+	{
+		component.reset(_sampleRate);
+		next.reset(_sampleRate);
+	}
+
+	/** set the input (source) resistance; only used by the first adaptor in the chain */
+	void setSourceResistance(double _sourceResistance) { sourceResistance = _sourceResistance; }
+
+	/** initialize the chain of adaptors from this one downstream */
+	void initializeAdaptorChain() { initialize(sourceResistance); }
+
+	/** calculate the coefficient for port 1 resistance R1, then pass R2 downstream */
+	void initialize(double R1)
+	{
+		double G1 = 1.0 / R1;
+		double componentConductance = component.getComponentConductance();
+		A = G1 / (G1 + componentConductance);
+		next.initialize(1.0 / ((1.0 / R1) + componentConductance));
+	}
+
+	/** scatter: wave in at port 1, returns the wave reflected out of port 1 */
+	inline double process(double in1)
+	{
+		double N2 = component.getOutput();
+		double in2 = next.process(N2 - A*(-in1 + N2));
+
+		double N1 = in2 - A*(-in1 + N2);
+		component.setInput(N1);
+		return -in1 + N2 + N1;
+	}
+
+	/** y(n) at the end of the chain */
+	inline double getTerminalOutput() { return next.getTerminalOutput(); }
+
+	/** the component on port 3 */
+	Component& getComponent() { return component; }
+
+	/** the adaptor on port 2 */
+	Next& getNext() { return next; }
+
+	/** state registers down the chain, for WdfStaticStateSpace */
+	static const uint32_t numRegisters = Component::numRegisters + Next::numRegisters;
+	void getRegisters(double* registers)
+	{
+		component.getRegisters(registers);
+		next.getRegisters(registers + Component::numRegisters);
+	}
+	void setRegisters(const double* registers)
+	{
+		component.setRegisters(registers);
+		next.setRegisters(registers + Component::numRegisters);
+	}
+
+protected:
+	Component component;			///< component on port 3
+	Next next;						///< downstream adaptor on port 2
+	double A = 0.0;					///< A coefficient value
+	double sourceResistance = 600.0;///< source impedance
+};
+
+/**
+\class WdfStaticSeriesTerminatedAdaptor
+\ingroup WDF-Objects
+\brief
+The WdfStaticSeriesTerminatedAdaptor object implements the series terminated adaptor that ends a static WDF
+ladder; see WdfStaticSeriesAdaptor. The arithmetic is identical to WdfSeriesTerminatedAdaptor.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+template <typename Component>
+class WdfStaticSeriesTerminatedAdaptor
+{
+public:
+	/** reset the component */
+	void reset(double _sampleRate) { component.reset(_sampleRate); out2 = 0.0; }
+
+	/** set the terminal (load) resistance */
+	void setTerminalResistance(double _terminalResistance) { terminalResistance = _terminalResistance; }
+
+	/** set the input (source) resistance; only used when this is the only adaptor */
+	void setSourceResistance(double _sourceResistance) { sourceResistance = _sourceResistance; }
+
+	/** initialize this adaptor as a one-adaptor chain */
+	void initializeAdaptorChain() { initialize(sourceResistance); }
+
+	/** calculate the coefficients for port 1 resistance R1 */
+	void initialize(double R1)
+	{
+		double componentResistance = component.getComponentResistance();
+		B1 = (2.0*R1) / (R1 + componentResistance + terminalResistance);
+		B3 = (2.0*terminalResistance) / (R1 + componentResistance + terminalResistance);
+	}
+
+	/** scatter: wave in at port 1, returns the wave reflected out of port 1 */
+	inline double process(double in1)
+	{
+		double N2 = component.getOutput();
+		double N3 = in1 + N2;
+
+		out2 = -B3*N3;
+		double out1 = in1 - B1*N3;
+
+		component.setInput(-(out1 + out2 + N3));
+		return out1;
+	}
+
+	/** y(n): the port 2 output */
+	inline double getTerminalOutput() { return out2; }
+
+	/** the component on port 3 */
+	Component& getComponent() { return component; }
+
+	/** state registers, for WdfStaticStateSpace */
+	static const uint32_t numRegisters = Component::numRegisters;
+	void getRegisters(double* registers) { component.getRegisters(registers); }
+	void setRegisters(const double* registers) { component.setRegisters(registers); }
+
+protected:
+	Component component;				///< component on port 3
+	double out2 = 0.0;					///< port 2 output; it is y(n) for this library
+	double B1 = 0.0;					///< B1 coefficient value
+	double B3 = 0.0;					///< B3 coefficient value
+	double terminalResistance = 600.0;	///< value of terminal (load) resistance
+	double sourceResistance = 600.0;	///< source impedance
+};
+
+/**
+\class WdfStaticParallelTerminatedAdaptor
+\ingroup WDF-Objects
+\brief
+The WdfStaticParallelTerminatedAdaptor object implements the parallel terminated adaptor that ends a static WDF
+ladder; see WdfStaticSeriesAdaptor. The arithmetic is identical to WdfParallelTerminatedAdaptor.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+template <typename Component>
+class WdfStaticParallelTerminatedAdaptor
+{
+public:
+	/** reset the component */
+	void reset(double _sampleRate) { component.reset(_sampleRate); out2 = 0.0; }
+
+	/** set the terminal (load) resistance */
+	void setTerminalResistance(double _terminalResistance) { terminalResistance = _terminalResistance; }
+
+	/** set the terminal (load) resistance as open circuit */
+	void setOpenTerminalResistance(bool _openTerminalResistance = true)
+	{
+		// --- flag overrides value
+		openTerminalResistance = _openTerminalResistance;
+		terminalResistance = 1.0e+34; // avoid /0.0
+	}
+
+	/** set the input (source) resistance; only used when this is the only adaptor */
+	void setSourceResistance(double _sourceResistance) { sourceResistance = _sourceResistance; }
+
+	/** initialize this adaptor as a one-adaptor chain */
+	void initializeAdaptorChain() { initialize(sourceResistance); }
+
+	/** calculate the coefficients for port 1 resistance R1 */
+	void initialize(double R1)
+	{
+		double G1 = 1.0 / R1;
+		if (terminalResistance <= 0.0)
+			terminalResistance = 1e-15;
+
+		double G2 = 1.0 / terminalResistance;
+		double componentConductance = component.getComponentConductance();
+
+		A1 = 2.0*G1 / (G1 + componentConductance + G2);
+		A3 = openTerminalResistance ? 0.0 : 2.0*G2 / (G1 + componentConductance + G2);
+	}
+
+	/** scatter: wave in at port 1, returns the wave reflected out of port 1 */
+	inline double process(double in1)
+	{
+		double N2 = component.getOutput();
+		double N1 = -A1*(-in1 + N2) + N2 - A3*N2;
+
+		out2 = N2 + N1;
+		component.setInput(N1);
+		return -in1 + N2 + N1;
+	}
+
+	/** y(n): the port 2 output */
+	inline double getTerminalOutput() { return out2; }
+
+	/** the component on port 3 */
+	Component& getComponent() { return component; }
+
+	/** state registers, for WdfStaticStateSpace */
+	static const uint32_t numRegisters = Component::numRegisters;
+	void getRegisters(double* registers) { component.getRegisters(registers); }
+	void setRegisters(const double* registers) { component.setRegisters(registers); }
+
+protected:
+	Component component;				///< component on port 3
+	double out2 = 0.0;					///< port 2 output; it is y(n) for this library
+	double A1 = 0.0;					///< A1 coefficient value
+	double A3 = 0.0;					///< A3 coefficient value
+	double terminalResistance = 600.0;	///< value of terminal (load) resistance
+	bool openTerminalResistance = false;///< flag for open circuit load
+	double sourceResistance = 600.0;	///< source impedance
+};
+
+/**
+\class WdfStaticStateSpace
+\ingroup WDF-Objects
+\brief
+The WdfStaticStateSpace object runs a cooked static WDF ladder as its equivalent state-space system.
+
+The wave scattering through a ladder is one long serial dependency per sample. With fixed component values the
+ladder is linear in its state registers and the input, so calculateMatrices( ) probes a copy of it once per
+parameter change (one pass per register plus one for the input) to get
+
+- s(n+1) = A s(n) + B x(n)
+- y(n) = C s(n) + D x(n)
+
+where s is the ladder's own register set. processAudioBlock( ) reads the registers out of the ladder, runs the
+matrices over the buffer and writes them back, so block and per-sample (ladder.process( )) calls can be mixed
+and a component change between blocks behaves exactly as it does in the WDF. Output matches the ladder to rounding.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+template <typename Ladder>
+class WdfStaticStateSpace
+{
+public:
+	static const uint32_t numStates = Ladder::numRegisters; ///< number of state registers
+
+	/** probe the cooked ladder; outputScale is applied to y(n); the ladder itself is not changed */
+	void calculateMatrices(Ladder& ladder, double outputScale = 1.0)
+	{
+		Ladder probe = ladder;
+		double state[numStates];
+
+		// --- columns 0..numStates-1: unit register, no input; last pass: unit input, clear registers
+		for (uint32_t j = 0; j <= numStates; j++)
+		{
+			for (uint32_t i = 0; i < numStates; i++)
+				state[i] = i == j ? 1.0 : 0.0;
+
+			probe.setRegisters(state);
+			probe.process(j == numStates ? 1.0 : 0.0);
+			double yn = outputScale*probe.getTerminalOutput();
+			probe.getRegisters(state);
+
+			for (uint32_t i = 0; i < numStates; i++)
+			{
+				if (j < numStates)
+					A[i][j] = state[i];
+				else
+					B[i] = state[i];
+			}
+
+			if (j < numStates)
+				C[j] = yn;
+			else
+				D = yn;
+		}
+	}
+
+	/** process a buffer from and back into the ladder's registers; in and out may alias */
+	void processAudioBlock(Ladder& ladder, const double* in, double* out, uint32_t count)
+	{
+		// --- local copies so the stores to out cannot force reloads of the matrices
+		double a[numStates][numStates];
+		double b[numStates];
+		double c[numStates];
+		memcpy(a, A, sizeof(a));
+		memcpy(b, B, sizeof(b));
+		memcpy(c, C, sizeof(c));
+		const double d = D;
+
+		// --- ping-pong the state rather than copying it back each sample
+		double stateBuffer[2][numStates];
+		double* state = stateBuffer[0];
+		double* nextState = stateBuffer[1];
+		ladder.getRegisters(state);
+
+		for (uint32_t n = 0; n < count; n++)
+		{
+			double xn = in[n];
+			double yn = d*xn;
+			for (uint32_t i = 0; i < numStates; i++)
+			{
+				yn += c[i] * state[i];
+				double si = b[i] * xn;
+				for (uint32_t j = 0; j < numStates; j++)
+					si += a[i][j] * state[j];
+				nextState[i] = si;
+			}
+
+			double* swap = state;
+			state = nextState;
+			nextState = swap;
+
+			out[n] = yn;
+		}
+
+		ladder.setRegisters(state);
+	}
+
+protected:
+	double A[numStates][numStates] = { { 0.0 } };	///< state transition
+	double B[numStates] = { 0.0 };					///< input to state
+	double C[numStates] = { 0.0 };					///< state to output
+	double D = 0.0;									///< input to output
+};
+
+/**
+\class WDFStaticTunableButterLPF3
+\ingroup WDF-Objects
+\brief
+The WDFStaticTunableButterLPF3 object is WDFTunableButterLPF3 built on the static WDF library:
+Series(L1) -> Parallel(C1) -> SeriesTerminated(L2), Rs = Rload = 600.
+
+Unlike WDFTunableButterLPF3, setFilterFc( ) re-initializes the adaptor chain so the new fc takes effect immediately.
+
+Audio I/O:
+- Processes mono input to mono output through the ladder
+- processAudioBlock( ) runs the WdfStaticStateSpace equivalent on the same registers (matches to rounding)
+
+Control I/F:
+- setUsePostWarping(bool b) to enable/disable warping (see book)
+- setFilterFc(double fc_Hz) to set the tunable fc value
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+class WDFStaticTunableButterLPF3 : public IAudioSignalProcessor
+{
+public:
+	WDFStaticTunableButterLPF3(void) { createWDF(); }	/* C-TOR */
+	~WDFStaticTunableButterLPF3(void) {}	/* D-TOR */
+
+	/** reset members to initialized state */
+	virtual bool reset(double _sampleRate)
+	{
+		sampleRate = _sampleRate;
+		ladder.reset(_sampleRate);
+		ladder.initializeAdaptorChain();
+		stateSpace.calculateMatrices(ladder);
+		return true;
+	}
+
+	/** return false: this object only processes samples */
+	virtual bool canProcessAudioFrame() { return false; }
+
+	/** process input x(n) through the WDF ladder filter to produce return value y(n) */
+	/**
+	\param xn input
+	\return the processed sample
+	*/
+	virtual double processAudioSample(double xn)
+	{
+		ladder.process(xn);
+		return ladder.getTerminalOutput();
+	}
+
+	/** process a buffer; in and out may alias */
+	virtual void processAudioBlock(const double* in, double* out, uint32_t count)
+	{
+		stateSpace.processAudioBlock(ladder, in, out, count);
+	}
+
+	/** create the filter structure; may be called more than once */
+	void createWDF()
+	{
+		// --- init to noramlized values fc = 1Hz
+		setComponentValues(1.0);
+		ladder.setSourceResistance(600.0); // --- Rs = 600
+		ladder.getNext().getNext().setTerminalResistance(600.0); // --- Rload = 600
+	}
+
+	/** parameter setter for warping */
+	void setUsePostWarping(bool b) { useFrequencyWarping = b; }
+
+	/** parameter setter for fc */
+	void setFilterFc(double fc_Hz)
+	{
+		if (useFrequencyWarping)
+		{
+			double arg = (kPi*fc_Hz) / sampleRate;
+			fc_Hz = fc_Hz*(tan(arg) / arg);
+		}
+
+		setComponentValues(fc_Hz);
+		ladder.initializeAdaptorChain();
+		stateSpace.calculateMatrices(ladder);
+	}
+
+protected:
+	// --- L1 -> C1 -> L2 (terminated)
+	typedef WdfStaticSeriesAdaptor<WdfStaticInductor,
+			WdfStaticParallelAdaptor<WdfStaticCapacitor,
+			WdfStaticSeriesTerminatedAdaptor<WdfStaticInductor>>> Ladder;
+	Ladder ladder;	///< the ladder
+	WdfStaticStateSpace<Ladder> stateSpace;	///< block-rate equivalent of the ladder
+
+	double L1_norm = 95.493;		// 95.5 mH
+	double C1_norm = 530.516e-6;	// 0.53 uF
+	double L2_norm = 95.493;		// 95.5 mH
+
+	bool useFrequencyWarping = false;	///< flag for freq warping
+	double sampleRate = 1.0;			///< stored sample rate
+
+	/** scale the normalized values to fc */
+	void setComponentValues(double fc_Hz)
+	{
+		ladder.getComponent().setComponentValue(L1_norm / fc_Hz);
+		ladder.getNext().getComponent().setComponentValue(C1_norm / fc_Hz);
+		ladder.getNext().getNext().getComponent().setComponentValue(L2_norm / fc_Hz);
+	}
+};
+
+/**
+\struct WdfIdealRLCLPFCircuit
+\ingroup WDF-Objects
+\brief
+Circuit description for WDFStaticIdealRLC: series RL -> parallel terminated C (output across C).
+Each circuit provides the Ladder type and setComponentValues( ) mapping the R/L/C values to its components.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+struct WdfIdealRLCLPFCircuit
+{
+	typedef WdfStaticSeriesAdaptor<WdfStaticSeriesRL, WdfStaticParallelTerminatedAdaptor<WdfStaticCapacitor>> Ladder;
+
+	static void setComponentValues(Ladder& ladder, double R, double L, double C)
+	{
+		ladder.getComponent().setComponentValue_RL(R, L);
+		ladder.getNext().getComponent().setComponentValue(C);
+	}
+};
+
+/**
+\struct WdfIdealRLCHPFCircuit
+\ingroup WDF-Objects
+\brief
+Circuit description for WDFStaticIdealRLC: series RC -> parallel terminated L (output across L).
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+struct WdfIdealRLCHPFCircuit
+{
+	typedef WdfStaticSeriesAdaptor<WdfStaticSeriesRC, WdfStaticParallelTerminatedAdaptor<WdfStaticInductor>> Ladder;
+
+	static void setComponentValues(Ladder& ladder, double R, double L, double C)
+	{
+		ladder.getComponent().setComponentValue_RC(R, C);
+		ladder.getNext().getComponent().setComponentValue(L);
+	}
+};
+
+/**
+\struct WdfIdealRLCBPFCircuit
+\ingroup WDF-Objects
+\brief
+Circuit description for WDFStaticIdealRLC: series LC -> parallel terminated R (output across R).
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+struct WdfIdealRLCBPFCircuit
+{
+	typedef WdfStaticSeriesAdaptor<WdfStaticSeriesLC, WdfStaticParallelTerminatedAdaptor<WdfStaticResistor>> Ladder;
+
+	static void setComponentValues(Ladder& ladder, double R, double L, double C)
+	{
+		ladder.getComponent().setComponentValue_LC(L, C);
+		ladder.getNext().getComponent().setComponentValue(R);
+	}
+};
+
+/**
+\struct WdfIdealRLCBSFCircuit
+\ingroup WDF-Objects
+\brief
+Circuit description for WDFStaticIdealRLC: series R -> parallel terminated series LC (output across LC).
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+struct WdfIdealRLCBSFCircuit
+{
+	typedef WdfStaticSeriesAdaptor<WdfStaticResistor, WdfStaticParallelTerminatedAdaptor<WdfStaticSeriesLC>> Ladder;
+
+	static void setComponentValues(Ladder& ladder, double R, double L, double C)
+	{
+		ladder.getComponent().setComponentValue(R);
+		ladder.getNext().getComponent().setComponentValue_LC(L, C);
+	}
+};
+
+/**
+\class WDFStaticIdealRLC
+\ingroup WDF-Objects
+\brief
+The WDFStaticIdealRLC object implements the ideal RLC filters (WDFIdealRLCLPF/HPF/BPF/BSF) on the static WDF
+library; the Circuit parameter selects the ladder (see WdfIdealRLCLPFCircuit). Use the WDFStaticIdealRLCLPF,
+WDFStaticIdealRLCHPF, WDFStaticIdealRLCBPF and WDFStaticIdealRLCBSF typedefs.
+
+C is held at 1uF as in the runtime versions; setParameters( ) recalculates R and L, re-initializes the adaptor
+chain and re-probes the WdfStaticStateSpace matrices.
+
+Audio I/O:
+- Processes mono input to mono output through the ladder
+- processAudioBlock( ) runs the state-space equivalent on the same registers (matches to rounding)
+
+Control I/F:
+- Use WDFParameters structure to get/set object params.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+template <typename Circuit>
+class WDFStaticIdealRLC : public IAudioSignalProcessor
+{
+public:
+	WDFStaticIdealRLC(void)		/* C-TOR */
+	{
+		// --- Rs = 0, open circuit load
+		ladder.setSourceResistance(0.0);
+		ladder.getNext().setOpenTerminalResistance(true);
+		setComponentValues();
+	}
+	~WDFStaticIdealRLC(void) {}	/* D-TOR */
+
+	/** reset members to initialized state */
+	virtual bool reset(double _sampleRate)
+	{
+		sampleRate = _sampleRate;
+		ladder.reset(_sampleRate);
+
+		// --- the warped fc depends on the sample rate
+		setComponentValues();
+		return true;
+	}
+
+	/** return false: this object only processes samples */
+	virtual bool canProcessAudioFrame() { return false; }
+
+	/** process input x(n) through the WDF Ideal RLC filter to produce return value y(n) */
+	/**
+	\param xn input
+	\return the processed sample
+	*/
+	virtual double processAudioSample(double xn)
+	{
+		ladder.process(xn);
+
+		// --- -6dB compensation as in the runtime versions
+		return 0.5*ladder.getTerminalOutput();
+	}
+
+	/** process a buffer; in and out may alias */
+	virtual void processAudioBlock(const double* in, double* out, uint32_t count)
+	{
+		stateSpace.processAudioBlock(ladder, in, out, count);
+	}
+
+	/** get parameters: note use of custom structure for passing param data */
+	/**
+	\return WDFParameters custom data structure
+	*/
+	WDFParameters getParameters() { return wdfParameters; }
+
+	/** set parameters: note use of custom structure for passing param data */
+	/**
+	\param WDFParameters custom data structure
+	*/
+	void setParameters(const WDFParameters& _wdfParameters)
+	{
+		if (_wdfParameters.fc != wdfParameters.fc ||
+			_wdfParameters.Q != wdfParameters.Q ||
+			_wdfParameters.boostCut_dB != wdfParameters.boostCut_dB ||
+			_wdfParameters.frequencyWarping != wdfParameters.frequencyWarping)
+		{
+			wdfParameters = _wdfParameters;
+			setComponentValues();
+		}
+	}
+
+protected:
+	WDFParameters wdfParameters;		///< object parameters
+	typename Circuit::Ladder ladder;	///< the ladder
+	WdfStaticStateSpace<typename Circuit::Ladder> stateSpace;	///< block-rate equivalent of the ladder
+	double sampleRate = 44100.0;		///< sample rate storage
+
+	/** calculate R and L for fc and Q with C = 1uF, then cook the adaptor chain */
+	void setComponentValues()
+	{
+		double fc_Hz = wdfParameters.fc;
+
+		if (wdfParameters.frequencyWarping)
+		{
+			double arg = (kPi*fc_Hz) / sampleRate;
+			fc_Hz = fc_Hz*(tan(arg) / arg);
+		}
+
+		double inductorValue = 1.0 / (1.0e-6 * pow((2.0*kPi*fc_Hz), 2.0));
+		double resistorValue = (1.0 / wdfParameters.Q)*(pow(inductorValue / 1.0e-6, 0.5));
+
+		Circuit::setComponentValues(ladder, resistorValue, inductorValue, 1.0e-6);
+		ladder.initializeAdaptorChain();
+		stateSpace.calculateMatrices(ladder, 0.5);
+	}
+};
+
+typedef WDFStaticIdealRLC<WdfIdealRLCLPFCircuit> WDFStaticIdealRLCLPF;	///< static-library ideal RLC LPF
+typedef WDFStaticIdealRLC<WdfIdealRLCHPFCircuit> WDFStaticIdealRLCHPF;	///< static-library ideal RLC HPF
+typedef WDFStaticIdealRLC<WdfIdealRLCBPFCircuit> WDFStaticIdealRLCBPF;	///< static-library ideal RLC BPF
+typedef WDFStaticIdealRLC<WdfIdealRLCBSFCircuit> WDFStaticIdealRLCBSF;	///< static-library ideal RLC BSF
+
+/**
+\class WDFLRFilterBank
+\ingroup WDF-Objects
+\brief
+The WDFLRFilterBank object is a drop-in alternative to LRFilterBank built from WDF ideal RLC ladders:
+a Q = 0.5 RLC LPF/HPF pair is the same analog 2nd order Linkwitz-Riley prototype, bilinear-transformed with
+fc pre-warping, so the bands match LRFilterBank to rounding while the signal runs through the modelled circuit.
+The RLC ladder outputs are polarity inverted, so here the LPF output is flipped and the HPF output is not,
+which gives the same band polarities as LRFilterBank (HF band inverted).
+
+Audio I/O:
+- Processes mono input into a custom FilterBankOutput structure.
+NOTE: processAudioSample( ) is inoperable and only returns the input back.
+
+Control I/F:
+- Use LRFilterBankParameters structure to get/set object params.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+class WDFLRFilterBank : public IAudioSignalProcessor
+{
+public:
+	WDFLRFilterBank()		/* C-TOR */
+	{
+		setParameters(parameters);
+	}
+
+	~WDFLRFilterBank() {}	/* D-TOR */
+
+	/** reset member objects */
+	virtual bool reset(double _sampleRate)
+	{
+		lpFilter.reset(_sampleRate);
+		hpFilter.reset(_sampleRate);
+		return true;
+	}
+
+	/** return false: this object only processes samples */
+	virtual bool canProcessAudioFrame() { return false; }
+
+	/** this does nothing for this object, see processFilterBank( ) below */
+	/**
+	\param xn input
+	\return the processed sample
+	*/
+	virtual double processAudioSample(double xn)
+	{
+		return xn;
+	}
+
+	/** process the filter bank */
+	FilterBankOutput processFilterBank(double xn)
 	{
-		// --- create components, init to noramlized values fc =
-		//	   initial values for fc = 1kHz Q = 0.707
-		//     Holding C Constant at 1e-6
-		//			   L = 2.533e-2
-		//			   R = 2.251131 e2
-		seriesAdaptor_R.setComponent(wdfComponent::R, 2.533e-2);
-		parallelTerminatedAdaptor_LC.setComponent(wdfComponent::seriesLC, 2.533e-2, 1.0e-6);
+		FilterBankOutput output;
 
-		// --- connect adapters
-		WdfAdaptorBase::connectAdaptors(&seriesAdaptor_R, &parallelTerminatedAdaptor_LC);
+		// --- the ladder outputs are inverted: flip the LPF, leave the HPF inverted
+		output.LFOut = -lpFilter.processAudioSample(xn);
+		output.HFOut = hpFilter.processAudioSample(xn);
 
-		// --- set source resistance
-		seriesAdaptor_R.setSourceResistance(0.0); // --- Rs = 600
+		return output;
+	}
 
-		// --- set open ckt termination
-		parallelTerminatedAdaptor_LC.setOpenTerminalResistance(true);
+	/** this does nothing for this object (the input is copied), see processFilterBankBlock( ) below */
+	virtual void processAudioBlock(const double* input, double* output, uint32_t numSamples)
+	{
+		if (output != input)
+			memcpy(output, input, sizeof(double)*numSamples);
+	}
+
+	/** split a block into LF and HF bands with the ladders' block paths; either band may be the input buffer */
+	void processFilterBankBlock(const double* input, double* lfOutput, double* hfOutput, uint32_t numSamples)
+	{
+		// --- whichever band overwrites the input runs last
+		if (lfOutput == input)
+		{
+			hpFilter.processAudioBlock(input, hfOutput, numSamples);
+			lpFilter.processAudioBlock(input, lfOutput, numSamples);
+		}
+		else
+		{
+			lpFilter.processAudioBlock(input, lfOutput, numSamples);
+			hpFilter.processAudioBlock(input, hfOutput, numSamples);
+		}
+
+		for (uint32_t i = 0; i < numSamples; i++)
+			lfOutput[i] = -lfOutput[i];
 	}
 
 	/** get parameters: note use of custom structure for passing param data */
 	/**
-	\return WDFParameters custom data structure
+	\return LRFilterBankParameters custom data structure
 	*/
-	WDFParameters getParameters() { return wdfParameters; }
+	LRFilterBankParameters getParameters()
+	{
+		return parameters;
+	}
 
 	/** set parameters: note use of custom structure for passing param data */
 	/**
-	\param WDFParameters custom data structure
+	\param LRFilterBankParameters custom data structure
 	*/
-	void setParameters(const WDFParameters& _wdfParameters)
+	void setParameters(const LRFilterBankParameters& _parameters)
 	{
-		if (_wdfParameters.fc != wdfParameters.fc ||
-			_wdfParameters.Q != wdfParameters.Q ||
-			_wdfParameters.boostCut_dB != wdfParameters.boostCut_dB ||
-			_wdfParameters.frequencyWarping != wdfParameters.frequencyWarping)
-		{
-			wdfParameters = _wdfParameters;
-			double fc_Hz = wdfParameters.fc;
-
-			if (wdfParameters.frequencyWarping)
-			{
-				double arg = (kPi*fc_Hz) / sampleRate;
-				fc_Hz = fc_Hz*(tan(arg) / arg);
-			}
-
-			double inductorValue = 1.0 / (1.0e-6 * pow((2.0*kPi*fc_Hz), 2.0));
-			double resistorValue = (1.0 / wdfParameters.Q)*(pow(inductorValue / 1.0e-6, 0.5));
+		parameters = _parameters;
 
-			seriesAdaptor_R.setComponentValue(resistorValue);
-			parallelTerminatedAdaptor_LC.setComponentValue_LC(inductorValue, 1.0e-6);
-		}
+		WDFParameters params = lpFilter.getParameters();
+		params.fc = parameters.splitFrequency;
+		params.Q = 0.5;
+		params.frequencyWarping = true;
+		lpFilter.setParameters(params);
+		hpFilter.setParameters(params);
 	}
 
 protected:
-	WDFParameters wdfParameters;	///< object parameters
-
-	// --- adapters
-	WdfSeriesAdaptor				seriesAdaptor_R; ///< adaptor for series R
-	WdfParallelTerminatedAdaptor	parallelTerminatedAdaptor_LC; ///< adaptor for parallel LC
+	WDFStaticIdealRLCLPF lpFilter;	///< low-band filter
+	WDFStaticIdealRLCHPF hpFilter;	///< high-band filter
 
-	double sampleRate = 1.0; ///< sample rate storage
+	// --- object parameters
+	LRFilterBankParameters parameters; ///< parameters for the object
 };
 
 
@@ -8733,35 +12577,48 @@ class FastFFT
 public:
 	FastFFT() {}		/* C-TOR */
 	~FastFFT() {
-		if (windowBuffer) delete[] windowBuffer;
 		destroyFFTW();
 	}	/* D-TOR */
 
 	/** setup the FFT for a given framelength and window type*/
 	void initialize(unsigned int _frameLength, windowType _window);
 
-	/** destroy FFTW objects and plans */
+	/** destroy FFTW objects and plans; frees the buffers (window included) */
 	void destroyFFTW();
 
-	/** do the FFT and return real and imaginary arrays */
+	/** do the FFT and return real and imaginary arrays; real input (no inputImag) uses the r2c transform */
 	fftw_complex* doFFT(double* inputReal, double* inputImag = nullptr);
 
 	/** do the IFFT and return real and imaginary arrays */
 	fftw_complex* doInverseFFT(double* inputReal, double* inputImag);
 
+	/** do the r2c FFT of a real frame and return the getNumBins( ) non-redundant bins */
+	fftw_complex* doRealFFT(const double* input);
+
+	/** do the c2r IFFT of getNumBins( ) bins and return the (unnormalized) real frame */
+	double* doRealInverseFFT(const fftw_complex* spectrum);
+
 	/** get the current FFT length */
 	unsigned int getFrameLength() { return frameLength; }
 
+	/** get the number of bins of a real transform: N/2 + 1 */
+	unsigned int getNumBins() { return frameLength / 2 + 1; }
+
 protected:
-	// --- setup FFTW
+	// --- setup FFTW; the plans are shared through the FFTPlanRegistry
+	AudioArena		arena;						///< one block for the window and all arrays
 	fftw_complex*	fft_input = nullptr;		///< array for FFT input
 	fftw_complex*	fft_result = nullptr;		///< array for FFT output
 	fftw_complex*	ifft_input = nullptr;		///< array for IFFT input
 	fftw_complex*	ifft_result = nullptr;		///< array for IFFT output
+	double*			real_input = nullptr;		///< r2c input
+	double*			real_output = nullptr;		///< c2r output
 	fftw_plan       plan_forward = nullptr;		///< FFTW plan for FFT
 	fftw_plan		plan_backward = nullptr;	///< FFTW plan for IFFT
+	fftw_plan		plan_r2c = nullptr;			///< FFTW plan for real FFT
+	fftw_plan		plan_c2r = nullptr;			///< FFTW plan for real IFFT
 
-	double* windowBuffer = nullptr;				///< buffer for window (naked)
+	double* windowBuffer = nullptr;				///< buffer for window (naked, in the arena)
 	double windowGainCorrection = 1.0;			///< window gain correction
 	windowType window = windowType::kHannWindow; ///< window type
 	unsigned int frameLength = 0;				///< current FFT length
@@ -8792,16 +12649,13 @@ class PhaseVocoder
 public:
 	PhaseVocoder() {}		/* C-TOR */
 	~PhaseVocoder() {
-		if (inputBuffer) delete[] inputBuffer;
-		if (outputBuffer) delete[] outputBuffer;
-		if (windowBuffer) delete[] windowBuffer;
 		destroyFFTW();
 	}	/* D-TOR */
 
 	/** setup the FFT for a given framelength and window type*/
 	void initialize(unsigned int _frameLength, unsigned int _hopSize, windowType _window);
 
-	/** destroy FFTW objects and plans */
+	/** destroy FFTW objects and plans; frees the buffers (timelines and window included) */
 	void destroyFFTW();
 
 	/** process audio sample through vocode; check fftReady flag to access FFT output */
@@ -8813,11 +12667,14 @@ public:
 	/** increment the FFT counter and do the FFT if it is ready */
 	bool advanceAndCheckFFT();
 
-	/** get FFT data for manipulation (yes, naked pointer so you can manipulate) */
+	/** get FFT data for manipulation (yes, naked pointer so you can manipulate); getNumBins( ) bins of the r2c FFT */
 	fftw_complex* getFFTData() { return fft_result; }
 
-	/** get IFFT data for manipulation (yes, naked pointer so you can manipulate) */
-	fftw_complex* getIFFTData() { return ifft_result; }
+	/** get IFFT data for manipulation (yes, naked pointer so you can manipulate); frameLength real samples of the c2r IFFT */
+	double* getIFFTData() { return ifft_result; }
+
+	/** get the number of FFT bins: N/2 + 1 for the real transform */
+	unsigned int getNumBins() { return frameLength / 2 + 1; }
 
 	/** do the inverse FFT (optional; will be called automatically if not used) */
 	void doInverseFFT();
@@ -8840,12 +12697,15 @@ public:
 	void setOverlapAddOnly(bool b){ bool overlapAddOnly = b; }
 
 protected:
-	// --- setup FFTW
-	fftw_complex*	fft_input = nullptr;		///< array for FFT input
-	fftw_complex*	fft_result = nullptr;		///< array for FFT output
-	fftw_complex*	ifft_result = nullptr;		///< array for IFFT output
-	fftw_plan       plan_forward = nullptr;		///< FFTW plan for FFT
-	fftw_plan		plan_backward = nullptr;	///< FFTW plan for IFFT
+	// --- every buffer below is carved from one arena block in initialize( )
+	AudioArena		arena;						///< one block for the timelines, window and FFT arrays
+
+	// --- setup FFTW; r2c/c2r with plans shared through the FFTPlanRegistry
+	double*			fft_input = nullptr;		///< array for FFT input (real)
+	fftw_complex*	fft_result = nullptr;		///< array for FFT output (N/2 + 1 bins)
+	double*			ifft_result = nullptr;		///< array for IFFT output (real)
+	fftw_plan       plan_forward = nullptr;		///< FFTW plan for FFT (r2c)
+	fftw_plan		plan_backward = nullptr;	///< FFTW plan for IFFT (c2r)
 
 	// --- linear buffer for window
 	double*			windowBuffer = nullptr;		///< array for window
@@ -8887,164 +12747,248 @@ protected:
 
 };
 
+// --- FastConvolver non-uniform partitioning
+const unsigned int FAST_CONVOLVER_HEAD_LEN = 64;			///< partition length of the zero-latency head stage
+const unsigned int FAST_CONVOLVER_GROWTH = 8;				///< partition length ratio from one stage to the next
+const unsigned int FAST_CONVOLVER_MAX_STAGES = 3;			///< stages after the head stage; the last one takes the rest of the IR
+const unsigned int FAST_CONVOLVER_THREAD_MIN_LEN = 1024;	///< stages with partitions at least this long may run on the worker
+const unsigned int FAST_CONVOLVER_MAX_WAIT_USEC = 50;		///< longest the audio thread waits for a late worker job
+
 /**
-\class FastConvolver
+\class ConvolutionStage
 \ingroup FFTW-Objects
 \brief
-The FastConvolver provides a fast convolver - the user supplies the filter IR and the object
-snapshots the FFT of that filter IR. Input audio is fast-convovled with the filter FFT using
-complex multiplication and zero-padding.
+The ConvolutionStage is one uniformly partitioned segment of a non-uniform convolver: it convolves the input with
+the IR taps [2B, 2B + numPartitions x B) using overlap-save with partition length B and r2c/c2r transforms.
 
-Audio I/O:
-- processes mono input into mono output.
+Because the segment starts 2B taps in, the spectrum work for input block k is not needed until block k + 2 starts;
+that one block of slack is the deadline that lets the work (the "job") run on a background thread:
+- endOfBlock( ) retires job k - 1 (running it here if the worker has not picked it up), then queues job k
+- the job runs the r2c, the frequency domain delay line multiply-accumulate and the c2r into one of two result blocks
+- without a worker the job runs inline at the end of the block; the output timing is identical
 
-Control I/F:
-- none.
+Deadline contract for threaded stages: the worker has one block (B samples) to finish job k - 1. If it is still
+running at the end of block k, the audio thread waits at most FAST_CONVOLVER_MAX_WAIT_USEC and then counts an
+xrun: the next block reads the previous result again, block k gets no job and enters the delay line as silence,
+and the stage is back on schedule once the late job is done. getXrunCount( ) reports the misses.
 
-\author Will Pirkle http://www.willpirkle.com
-\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+setSegment( ) holds the job state in kUpdating while it rewrites the partition spectra; blocks that end during the
+update get no job and enter the delay line as silence, like an xrun, but are not counted as one.
+
+All buffers are carved from one AudioArena block in initialize( ), which also gets the plans.
+
+\author Christian George
 \version Revision : 1.0
-\date Date : 2018 / 09 / 7
+\date Date : 2026 / 10 / 18
 */
-class FastConvolver
+class ConvolutionStage
 {
 public:
-	FastConvolver() {
-		vocoder.setOverlapAddOnly(true);
-	}		/* C-TOR */
-	~FastConvolver() {
-		if (filterIR)
-			delete[] filterIR;
+	ConvolutionStage() {}						/* C-TOR */
+	~ConvolutionStage() { destroyFFTW(); }		/* D-TOR */
 
-		if (filterFFT)
-			fftw_free(filterFFT);
-	}	/* D-TOR */
-
-	/** setup the FFT for a given IR length */
+	/** allocate buffers and plans; not real-time safe */
 	/**
-	\param _filterImpulseLength the filter IR length, which is 1/2 FFT length due to need for zero-padding (see FX book)
+	\param _partitionLength partition length B (the segment starts at tap 2B)
+	\param _numPartitions number of partitions in the segment
+	\param _workerSignal semaphore of the worker thread, or nullptr to run the jobs inline
 	*/
-	void initialize(unsigned int _filterImpulseLength)
-	{
-		if (filterImpulseLength == _filterImpulseLength)
-			return;
+	void initialize(unsigned int _partitionLength, unsigned int _numPartitions, moodycamel::spsc_sema::LightweightSemaphore* _workerSignal);
 
-		// --- setup a specialized vocoder with 50% hop size
-		filterImpulseLength = _filterImpulseLength;
-		vocoder.initialize(filterImpulseLength * 2, filterImpulseLength, windowType::kNoWindow);
-
-		// --- initialize the FFT object for capturing the filter FFT
-		filterFastFFT.initialize(filterImpulseLength * 2, windowType::kNoWindow);
+	/** destroy FFTW objects, plans and buffers */
+	void destroyFFTW();
 
-		// --- array to hold the filter IR; this could be localized to the particular function that uses it
-		if (filterIR)
-			delete [] filterIR;
-		filterIR = new double[filterImpulseLength * 2];
-		memset(&filterIR[0], 0, filterImpulseLength * 2 * sizeof(double));
+	/** load the segment taps (count may be less than the segment length; the rest is zero) */
+	void setSegment(const double* taps, unsigned int count);
 
-		// --- allocate the filter FFT arrays
-		if(filterFFT)
-			fftw_free(filterFFT);
+	/** flush the input, delay line and results */
+	void reset();
 
-		 filterFFT = (fftw_complex*)fftw_malloc(sizeof(fftw_complex) * filterImpulseLength * 2);
+	/** process one sample; returns this segment's contribution to y(n) */
+	inline double processAudioSample(double xn)
+	{
+		double yn = results[readSlot * partitionLength + blockIndex];
+		inputFrame[partitionLength + blockIndex] = xn;
 
-		 // --- reset
-		 inputCount = 0;
+		if (++blockIndex == partitionLength)
+		{
+			blockIndex = 0;
+			endOfBlock();
+		}
+		return yn;
 	}
 
-	/** setup the filter IRirBuffer MUST be exactly filterImpulseLength in size, or this will crash! */
-	void setFilterIR(double* irBuffer)
-	{
-		if (!irBuffer) return;
+	/** worker side: run the job if it is queued and nobody has claimed it */
+	void runJobIfQueued();
 
-		memset(&filterIR[0], 0, filterImpulseLength * 2 * sizeof(double));
+	/** wait for any queued or running job to finish (runs it here if it has not started); unbounded, so this is
+	    for the control side (setSegment( ), reset( ), teardown), not the audio callback */
+	void finishJob();
 
-		// --- copy over first half; filterIR len = filterImpulseLength * 2
-		int m = 0;
-		for (unsigned int i = 0; i < filterImpulseLength; i++)
-		{
-			filterIR[i] = irBuffer[i];
-		}
+	/** true if the jobs run on the worker thread */
+	bool usesWorker() { return workerSignal != nullptr; }
 
-		// --- take FFT of the h(n)
-		fftw_complex* fftOfFilter = filterFastFFT.doFFT(&filterIR[0]);
+	/** get the number of missed worker deadlines since initialize( ); safe from any thread */
+	uint32_t getXrunCount() { return xrunCount.load(std::memory_order_relaxed); }
 
-		// --- copy the FFT into our local buffer for storage; also
-		//     we never want to hold a pointer to a FFT output
-		//     for more than one local function's worth
-		//     could replace with memcpy( )
-		for (int i = 0; i < 2; i++)
-		{
-			for (unsigned int j = 0; j < filterImpulseLength * 2; j++)
-			{
-				filterFFT[j][i] = fftOfFilter[j][i];
-			}
-		}
-	}
+	/** get the partition length */
+	unsigned int getPartitionLength() { return partitionLength; }
 
-	/** process an input sample through convolver */
-	double processAudioSample(double input)
-	{
-		bool fftReady = false;
-		double output = 0.0;
+protected:
+	enum { kIdle, kPreparing, kQueued, kRunning, kDone, kUpdating };
+
+	/** block boundary: retire job k - 1, snapshot the input frame and queue job k */
+	void endOfBlock();
+
+	/** audio side of finishJob( ): waits at most FAST_CONVOLVER_MAX_WAIT_USEC; false if the job is still running */
+	bool retireJob();
+
+	/** the spectrum work for one block */
+	void runJob();
+
+	AudioArena arena;						///< one block for every buffer below
+	fftw_plan plan_forward = nullptr;		///< shared r2c plan, 2B
+	fftw_plan plan_backward = nullptr;		///< shared c2r plan, 2B
+	double* inputFrame = nullptr;			///< [previous block | current block]
+	double* jobFrame = nullptr;				///< snapshot of inputFrame for the job
+	fftw_complex* spectrum = nullptr;		///< r2c output
+	fftw_complex* accumulator = nullptr;	///< c2r input
+	double* ifftOutput = nullptr;			///< c2r output
+	double* fdlReal = nullptr;				///< frequency domain delay line, numPartitions x numBins
+	double* fdlImag = nullptr;				///< frequency domain delay line, numPartitions x numBins
+	double* irReal = nullptr;				///< partition spectra, numPartitions x numBins
+	double* irImag = nullptr;				///< partition spectra, numPartitions x numBins
+	double* accReal = nullptr;				///< multiply-accumulate result
+	double* accImag = nullptr;				///< multiply-accumulate result
+	double* results = nullptr;				///< two result blocks, read during blocks k + 2 (parity)
+
+	unsigned int partitionLength = 0;		///< B
+	unsigned int fftLength = 0;				///< 2B
+	unsigned int numBins = 0;				///< B + 1
+	unsigned int numPartitions = 0;			///< partitions in the segment
+	unsigned int blockIndex = 0;			///< position in the current block
+	unsigned int readSlot = 0;				///< result block being read
+	unsigned int jobSlot = 0;				///< result block the queued job writes
+	unsigned int fdlIndex = 0;				///< newest slot in the delay line
+	unsigned int skippedBlocks = 0;			///< blocks without a job since the last queued one (audio thread)
+	unsigned int jobSkippedBlocks = 0;		///< skipped blocks the queued job enters as silence
+
+	std::atomic<int> jobState{ kIdle };		///< job hand-off between the audio and worker threads
+	std::atomic<uint32_t> xrunCount{ 0 };	///< missed worker deadlines
+	moodycamel::spsc_sema::LightweightSemaphore* workerSignal = nullptr; ///< wakes the worker; nullptr = inline
+};
 
-		if (inputCount == filterImpulseLength)
-		{
-			fftReady = vocoder.addZeroPad(filterImpulseLength);
+/**
+\class FastConvolver
+\ingroup FFTW-Objects
+\brief
+The FastConvolver provides a fast, zero-latency, non-uniformly partitioned convolver - the user supplies the filter IR
+and the object snapshots the spectra of its partitions.
+
+- head stage: a PartitionedConvolver with FAST_CONVOLVER_HEAD_LEN partitions covers the first 2 x B1 taps
+- stage s: a ConvolutionStage with partitions B(s) = FAST_CONVOLVER_HEAD_LEN x FAST_CONVOLVER_GROWTH^s covers
+  [2 x B(s), 2 x B(s + 1)); the last stage covers the rest of the IR
+- short partitions keep the latency at zero, long partitions keep the cost of long IRs low
+- with background processing enabled, stages with partitions of at least FAST_CONVOLVER_THREAD_MIN_LEN run their
+  FFT work on a worker thread, one block ahead of the deadline; the audio thread picks up a job itself if the
+  worker has not started it in time; a job the worker started but has not finished by the deadline is an xrun
+  (see ConvolutionStage and getXrunCount( )), the audio thread never waits on it for long
+- initialize( ) allocates everything; setFilterIR( ) and processAudioSample( ) do not allocate
 
-			if (fftReady) // should happen on time
-			{
-				// --- multiply our filter IR with the vocoder FFT
-				fftw_complex* signalFFT = vocoder.getFFTData();
-				if (signalFFT)
-				{
-					unsigned int fff = vocoder.getFrameLength();
+Audio I/O:
+- processes mono input into mono output.
 
-					// --- complex multiply with FFT of IR
-					for (unsigned int i = 0; i < filterImpulseLength * 2; i++)
-					{
-						// --- get real/imag parts of each FFT
-						ComplexNumber signal(signalFFT[i][0], signalFFT[i][1]);
-						ComplexNumber filter(filterFFT[i][0], filterFFT[i][1]);
+Control I/F:
+- setBackgroundProcessing( ) before initialize( ).
+- setFilterIR( ) holds each long stage while its spectra change, so the worker never runs a job on a half-loaded
+  IR; the head stage is rewritten in place, so do not call it while another thread is in processAudioSample( ).
 
-						// --- use complex multiply function; this convolves in the time domain
-						ComplexNumber product = complexMultiply(signal, filter);
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 18
+*/
+class FastConvolver
+{
+public:
+	FastConvolver() {}						/* C-TOR */
+	~FastConvolver() { stopWorker(); }		/* D-TOR */
 
-						// --- overwrite the FFT bins
-						signalFFT[i][0] = product.real;
-						signalFFT[i][1] = product.imag;
-					}
-				}
-			}
+	/** setup the stages for a given IR length; not real-time safe */
+	/**
+	\param _filterImpulseLength the filter IR length
+	*/
+	void initialize(unsigned int _filterImpulseLength);
 
-			// --- reset counter
-			inputCount = 0;
-		}
+	/** setup the filter IR; irBuffer MUST be exactly filterImpulseLength in size */
+	void setFilterIR(double* irBuffer);
 
-		// --- process next sample
-		output = vocoder.processAudioSample(input, fftReady);
-		inputCount++;
+	/** flush all stages; the IR is kept */
+	void reset();
 
+	/** process an input sample through convolver */
+	double processAudioSample(double input)
+	{
+		double output = headStage.processAudioSample(input);
+		for (unsigned int s = 0; s < numStages; s++)
+			output += stages[s].processAudioSample(input);
 		return output;
 	}
 
-	/** get current frame length */
-	unsigned int getFrameLength() { return vocoder.getFrameLength(); }
+	/** process a block; in and out may be the same buffer */
+	void processAudioBlock(const double* in, double* out, unsigned int count)
+	{
+		for (unsigned int i = 0; i < count; i++)
+			out[i] = processAudioSample(in[i]);
+	}
+
+	/** enable the background worker for the long stages; takes effect at the next initialize( ), which then lays
+	    out the stages again even if the length is unchanged (load the IR again afterwards) */
+	void setBackgroundProcessing(bool b) { backgroundProcessing = b; }
+
+	/** get the longest FFT length in use */
+	unsigned int getFrameLength() { return numStages > 0 ? 2 * stages[numStages - 1].getPartitionLength() : 2 * FAST_CONVOLVER_HEAD_LEN; }
 
 	/** get current IR length*/
 	unsigned int getFilterIRLength() { return filterImpulseLength; }
 
+	/** get the latency in samples (always 0) */
+	unsigned int getLatency() { return 0; }
+
+	/** get the number of missed worker deadlines in all stages; safe from any thread */
+	uint32_t getXrunCount()
+	{
+		uint32_t count = 0;
+		for (unsigned int s = 0; s < numStages; s++)
+			count += stages[s].getXrunCount();
+		return count;
+	}
+
 protected:
-	PhaseVocoder vocoder;				///< vocoder object
-	FastFFT filterFastFFT;				///< FastFFT object
-	fftw_complex* filterFFT = nullptr;	///< filterFFT output arrays
-	double* filterIR = nullptr;			///< filter IR
-	unsigned int inputCount = 0;		///< input sample counter
-	unsigned int filterImpulseLength = 0;///< IR length
+	/** start and stop the worker thread */
+	void startWorker();
+	void stopWorker();
+
+	PartitionedConvolver headStage;						///< zero-latency head stage
+	ConvolutionStage stages[FAST_CONVOLVER_MAX_STAGES];	///< longer stages
+	unsigned int stageOffset[FAST_CONVOLVER_MAX_STAGES] = { 0 };	///< first tap of each stage
+	unsigned int numStages = 0;							///< stages in use
+	unsigned int headLength = 0;						///< taps covered by the head stage
+	unsigned int filterImpulseLength = 0;				///< IR length
+
+	bool backgroundProcessing = false;					///< run the long stages on the worker
+	bool layoutBackgroundProcessing = false;			///< backgroundProcessing at the last initialize( )
+	std::thread worker;									///< background worker
+	std::atomic<bool> quitWorker{ false };				///< worker exit flag
+	moodycamel::spsc_sema::LightweightSemaphore workerSignal; ///< wakes the worker
 };
 
 // --- PSM Vocoder
 const unsigned int PSM_FFT_LEN = 4096;
+const unsigned int PSM_NUM_BINS = PSM_FFT_LEN / 2 + 1;	///< bins of the r2c spectrum
+const unsigned int PSM_PEAK_TRACKING_RANGE = PSM_FFT_LEN / 4;	///< farthest (in bins) a tracked peak may have moved
+const double PSM_MAX_PITCH_SHIFT = 24.0;					///< largest shift (semitones, up or down)
+const unsigned int PSM_MAX_OUTPUT_LEN = PSM_FFT_LEN * 4;	///< resampled frame length at -PSM_MAX_PITCH_SHIFT
+const unsigned int PSM_WINDOW_CACHE_SIZE = 4;				///< Hann windows kept for recent output lengths
 
 /**
 \struct BinData
@@ -9158,29 +13102,25 @@ class PSMVocoder : public IAudioSignalProcessor
 public:
 	PSMVocoder() {
 		vocoder.initialize(PSM_FFT_LEN, PSM_FFT_LEN/4, windowType::kHannWindow);  // 75% overlap
-	}		/* C-TOR */
-	~PSMVocoder() {
-		if (windowBuff) delete[] windowBuff;
-		if (outputBuff) delete[] outputBuff;
 
-	}	/* D-TOR */
+		// --- everything setPitchShift( ) needs, at the largest size it can ask for, in one zeroed arena block
+		arena.prepare(AudioArena::getAllocationSize<double>(PSM_MAX_OUTPUT_LEN) +
+					  AudioArena::getAllocationSize<double>(PSM_WINDOW_CACHE_SIZE * PSM_MAX_OUTPUT_LEN));
+		outputBuff = arena.allocate<double>(PSM_MAX_OUTPUT_LEN);
+		windowCache = arena.allocate<double>(PSM_WINDOW_CACHE_SIZE * PSM_MAX_OUTPUT_LEN);
+	}		/* C-TOR */
+	~PSMVocoder() {}	/* D-TOR */
 
 	/** reset members to initialized state */
 	virtual bool reset(double _sampleRate)
 	{
-		memset(&phi[0], 0, sizeof(double)*PSM_FFT_LEN);
-		memset(&psi[0], 0, sizeof(double)* PSM_FFT_LEN);
+		memset(&phi[0], 0, sizeof(double)*PSM_NUM_BINS);
+		memset(&psi[0], 0, sizeof(double)* PSM_NUM_BINS);
 		if(outputBuff)
 			memset(outputBuff, 0, sizeof(double)*outputBufferLength);
 
-		for (int i = 0; i < PSM_FFT_LEN; i++)
-		{
-			binData[i].reset();
-			binDataPrevious[i].reset();
-
-			peakBins[i] = -1;
-			peakBinsPrevious[i] = -1;
-		}
+		numPeaks = 0;
+		numPeaksPrevious = 0;
 
 		return true;
 	}
@@ -9188,12 +13128,15 @@ public:
 	/** return false: this object only processes samples */
 	virtual bool canProcessAudioFrame() { return false; }
 
-	/** set the pitch shift in semitones (note that this can be fractional too)*/
+	/** set the pitch shift in semitones (note that this can be fractional too); never allocates */
 	void setPitchShift(double semitones)
 	{
+		// --- the resampled frame must fit the vocoder's 4N output buffer
+		boundValue(semitones, -PSM_MAX_PITCH_SHIFT, PSM_MAX_PITCH_SHIFT);
+
 		// --- this is costly so only update when things changed
 		double newAlpha = pow(2.0, semitones / 12.0);
-		double newOutputBufferLength = round((1.0/newAlpha)*(double)PSM_FFT_LEN);
+		unsigned int newOutputBufferLength = (unsigned int)round((1.0/newAlpha)*(double)PSM_FFT_LEN);
 
 		// --- check for change
 		if (newOutputBufferLength == outputBufferLength)
@@ -9203,156 +13146,114 @@ public:
 		alphaStretchRatio = newAlpha;
 		ha = hs / alphaStretchRatio;
 
-		// --- set output resample buffer
+		// --- set output resample length; the buffer is preallocated at the maximum length
 		outputBufferLength = newOutputBufferLength;
 
-		// --- create Hann window
-		if (windowBuff) delete[] windowBuff;
-		windowBuff = new double[outputBufferLength];
-		windowCorrection = 0.0;
-		for (unsigned int i = 0; i < outputBufferLength; i++)
+		// --- Hann window for this length, from the cache
+		unsigned int slot = getCachedWindow(outputBufferLength);
+		windowBuff = &windowCache[slot * PSM_MAX_OUTPUT_LEN];
+		windowCorrection = windowCacheCorrection[slot];
+	}
+
+	/** find the local maxima of the magnitude spectrum (larger than two bins on either side); returns the count */
+	unsigned int findPeaks()
+	{
+		// --- magnitude[] has two zero guard bins on each side, so there are no edge cases and no branches
+		const double* mag = &magnitude[2];
+		unsigned int m = 0;
+		for (int i = 0; i < (int)PSM_NUM_BINS; i++)
 		{
-			windowBuff[i] = 0.5 * (1.0 - cos((i*2.0*kPi) / (outputBufferLength)));
-			windowCorrection += windowBuff[i];
+			const double mk = mag[i];
+			const bool isPeak = (mk > 0.00001) & (mk > mag[i - 2]) & (mk > mag[i - 1]) & (mk > mag[i + 1]) & (mk > mag[i + 2]);
+			peakBins[m] = i;
+			m += isPeak ? 1 : 0;
 		}
-		windowCorrection = 1.0 / windowCorrection;
-
-		// --- create output buffer
-		if (outputBuff) delete[] outputBuff;
-		outputBuff = new double[outputBufferLength];
-		memset(outputBuff, 0, sizeof(double)*outputBufferLength);
+		return m;
 	}
 
-	/** find bin index of nearest peak bin in previous FFT frame */
-	int findPreviousNearestPeak(int peakIndex)
+	/** match each peak to the nearest peak of the previous frame; both lists are sorted so one merge pass does it */
+	void trackPeaks()
 	{
-		if (peakBinsPrevious[0] == -1) // first run, there is no peak
-			return -1;
-
-		int delta = -1;
-		int previousPeak = -1;
-		for (int i = 0; i < PSM_FFT_LEN; i++)
+		unsigned int j = 0;
+		for (unsigned int n = 0; n < numPeaks; n++)
 		{
-			if (peakBinsPrevious[i] < 0)
-				break;
-
-			int dist = abs(peakIndex - peakBinsPrevious[i]);
-			if (dist > PSM_FFT_LEN/4)
-				break;
-
-			if (i == 0)
-			{
-				previousPeak = i;
-				delta = dist;
-			}
-			else if (dist < delta)
+			const int bin = peakBins[n];
+			if (numPeaksPrevious == 0)
 			{
-				previousPeak = i;
-				delta = dist;
+				previousPeakBins[n] = -1;
+				continue;
 			}
-		}
 
-		return previousPeak;
+			// --- the nearest previous peak never moves down as the bin moves up
+			while (j + 1 < numPeaksPrevious && abs(peakBinsPrevious[j + 1] - bin) <= abs(peakBinsPrevious[j] - bin))
+				j++;
+
+			previousPeakBins[n] = abs(peakBinsPrevious[j] - bin) <= (int)PSM_PEAK_TRACKING_RANGE ? peakBinsPrevious[j] : -1;
+		}
 	}
 
-	/** identify peak bins and tag their respective regions of influence */
-	void findPeaksAndRegionsOfInfluence()
+	/** horizontal phase propagation: the unwrapped phase increment of every bin since the last frame */
+	void advancePhases()
 	{
-		// --- FIND PEAKS --- //
-		//
-		// --- find local maxima in 4-sample window
-		double localWindow[4] = { 0.0 };
-		int m = 0;
-		for (int i = 0; i < PSM_FFT_LEN; i++)
+		// --- the frames really are hs apart (ha = hs/alpha is the hop of the virtual, stretched timeline),
+		//     so unwrap against omega_k*hs; unwrapping against ha scales the 2pi ambiguity by alpha and detunes the output
+		const double omegaHs = kTwoPi * hs / PSM_FFT_LEN;
+		for (unsigned int i = 0; i < PSM_NUM_BINS; i++)
 		{
-			if (i == 0)
-			{
-				localWindow[0] = 0.0;
-				localWindow[1] = 0.0;
-				localWindow[2] = binData[i + 1].magnitude;
-				localWindow[3] = binData[i + 2].magnitude;
-			}
-			else  if (i == 1)
-			{
-				localWindow[0] = 0.0;
-				localWindow[1] = binData[i - 1].magnitude;
-				localWindow[2] = binData[i + 1].magnitude;
-				localWindow[3] = binData[i + 2].magnitude;
-			}
-			else  if (i == PSM_FFT_LEN - 1)
-			{
-				localWindow[0] = binData[i - 2].magnitude;
-				localWindow[1] = binData[i - 1].magnitude;
-				localWindow[2] = 0.0;
-				localWindow[3] = 0.0;
-			}
-			else  if (i == PSM_FFT_LEN - 2)
-			{
-				localWindow[0] = binData[i - 2].magnitude;
-				localWindow[1] = binData[i - 1].magnitude;
-				localWindow[2] = binData[i + 1].magnitude;
-				localWindow[3] = 0.0;
-			}
-			else
-			{
-				localWindow[0] = binData[i - 2].magnitude;
-				localWindow[1] = binData[i - 1].magnitude;
-				localWindow[2] = binData[i + 1].magnitude;
-				localWindow[3] = binData[i + 2].magnitude;
-			}
+			// --- phase deviation is actual - expected phase = phi_k - (phi(last frame) + wk*hs)
+			const double expected = omegaHs * i;
+			deltaPhi[i] = expected + wrapPhase(phase[i] - phi[i] - expected);
 
-			// --- found peak bin!
-			if (binData[i].magnitude > 0.00001 &&
-				binData[i].magnitude > localWindow[0]
-				&& binData[i].magnitude > localWindow[1]
-				&& binData[i].magnitude > localWindow[2]
-				&& binData[i].magnitude > localWindow[3])
-			{
-				binData[i].isPeak = true;
-				peakBins[m++] = i;
+			// --- save for next frame
+			phi[i] = phase[i];
+		}
+	}
 
-				// --- for peak bins, assume that it is part of a previous, moving peak
-				if (parameters.enablePeakTracking)
-					binData[i].previousPeakBin = findPreviousNearestPeak(i);
-				else
-					binData[i].previousPeakBin = -1;
-			}
+	/** phase locking: each peak advances from its (tracked) predecessor and the bins in its region follow it */
+	void propagateLockedPhases()
+	{
+		numPeaks = findPeaks();
+
+		// --- nothing to lock to (silence): plain propagation
+		if (numPeaks == 0)
+		{
+			for (unsigned int i = 0; i < PSM_NUM_BINS; i++)
+				psi[i] = wrapPhase(psi[i] + deltaPhi[i] * alphaStretchRatio);
+			numPeaksPrevious = 0;
+			return;
 		}
 
-		// --- assign peak bosses
-		if (m > 0)
+		// --- a tracked peak may read a bin that an earlier region already overwrote, so keep last frame's phases
+		const double* psiSource = psi;
+		if (parameters.enablePeakTracking)
 		{
-			int n = 0;
-			int bossPeakBin = peakBins[n];
-			double nextPeak = peakBins[++n];
-			int midBoundary = (nextPeak - (double)bossPeakBin) / 2.0 + bossPeakBin;
+			trackPeaks();
+			memcpy(psiPrevious, psi, sizeof(double) * PSM_NUM_BINS);
+			psiSource = psiPrevious;
+		}
 
-			if (nextPeak >= 0)
-			{
-				for (int i = 0; i < PSM_FFT_LEN; i++)
-				{
-					if (i <= bossPeakBin)
-					{
-						binData[i].localPeakBin = bossPeakBin;
-					}
-					else if (i < midBoundary)
-					{
-						binData[i].localPeakBin = bossPeakBin;
-					}
-					else // > boundary, calc next set
-					{
-						bossPeakBin = nextPeak;
-						nextPeak = peakBins[++n];
-						if (nextPeak > bossPeakBin)
-							midBoundary = (nextPeak - (double)bossPeakBin) / 2.0 + bossPeakBin;
-						else // nextPeak == -1
-							midBoundary = PSM_FFT_LEN;
-
-						binData[i].localPeakBin = bossPeakBin;
-					}
-				}
-			}
+		unsigned int regionStart = 0;
+		for (unsigned int n = 0; n < numPeaks; n++)
+		{
+			const int peak = peakBins[n];
+			const int source = parameters.enablePeakTracking && previousPeakBins[n] >= 0 ? previousPeakBins[n] : peak;
+			const double psiPeak = wrapPhase(psiSource[source] + deltaPhi[peak] * alphaStretchRatio);
+
+			// --- region of influence: up to the midpoint between this peak and the next
+			const unsigned int regionEnd = n + 1 < numPeaks ? (peak + peakBins[n + 1]) / 2 : PSM_NUM_BINS;
+
+			// --- identity phase locking: bins keep their analysis phase offset from the peak
+			const double lockOffset = psiPeak - phase[peak];
+			for (unsigned int i = regionStart; i < regionEnd; i++)
+				psi[i] = wrapPhase(phase[i] + lockOffset);
+
+			psi[peak] = psiPeak;
+			regionStart = regionEnd;
 		}
+
+		// --- save the peaks for tracking in the next frame
+		memcpy(peakBinsPrevious, peakBins, sizeof(int) * numPeaks);
+		numPeaksPrevious = numPeaks;
 	}
 
 	/** process input sample through PSM vocoder */
@@ -9374,145 +13275,33 @@ public:
 			// --- get the FFT data
 			fftw_complex* fftData = vocoder.getFFTData();
 
-			if (parameters.enablePeakPhaseLocking)
-			{
-				// --- get the magnitudes for searching
-				for (int i = 0; i < PSM_FFT_LEN; i++)
-				{
-					binData[i].reset();
-					peakBins[i] = -1;
-
-					// --- store mag and phase
-					binData[i].magnitude = getMagnitude(fftData[i][0], fftData[i][1]);
-					binData[i].phi = getPhase(fftData[i][0], fftData[i][1]);
-				}
-
-				findPeaksAndRegionsOfInfluence();
-
-				// --- each bin data should now know its local boss-peak
-				//
-				// --- now propagate phases accordingly
-				//
-				//     FIRST: set PSI angles of bosses
-				for (int i = 0; i < PSM_FFT_LEN; i++)
-				{
-					double mag_k = binData[i].magnitude;
-					double phi_k = binData[i].phi;
-
-					// --- horizontal phase propagation
-					//
-					// --- omega_k = bin frequency(k)
-					double omega_k = kTwoPi*i / PSM_FFT_LEN;
-
-					// --- phase deviation is actual - expected phase
-					//     = phi_k -(phi(last frame) + wk*ha
-					double phaseDev = phi_k - phi[i] - omega_k*ha;
-
-					// --- unwrapped phase increment
-					double deltaPhi = omega_k*ha + principalArg(phaseDev);
-
-					// --- save for next frame
-					phi[i] = phi_k;
-
-					// --- if peak, assume it could have hopped from a different bin
-					if (binData[i].isPeak)
-					{
-						// --- calculate new phase based on stretch factor; save phase for next time
-						if(binData[i].previousPeakBin < 0)
-							psi[i] = principalArg(psi[i] + deltaPhi * alphaStretchRatio);
-						else
-							psi[i] = principalArg(psi[binDataPrevious[i].previousPeakBin] + deltaPhi * alphaStretchRatio);
-					}
-
-					// --- save peak PSI (new angle)
-					binData[i].psi = psi[i];
-
-					// --- for IFFT
-					binData[i].updatedPhase = binData[i].psi;
-				}
-
-				// --- now set non-peaks
-				for (int i = 0; i < PSM_FFT_LEN; i++)
-				{
-					if (!binData[i].isPeak)
-					{
-						int myPeakBin = binData[i].localPeakBin;
-
-						double PSI_kp = binData[myPeakBin].psi;
-						double phi_kp = binData[myPeakBin].phi;
-
-						// --- save for next frame
-						// phi[i] = binData[myPeakBin].phi;
-
-						// --- calculate new phase, locked to boss peak
-						psi[i] = principalArg(PSI_kp - phi_kp - binData[i].phi);
-						binData[i].updatedPhase = psi[i];// principalArg(PSI_kp - phi_kp - binData[i].phi);
-					}
-				}
-
-				for (int i = 0; i < PSM_FFT_LEN; i++)
-				{
-					double mag_k = binData[i].magnitude;
-
-					// --- convert back
-					fftData[i][0] = mag_k*cos(binData[i].updatedPhase);
-					fftData[i][1] = mag_k*sin(binData[i].updatedPhase);
-
-					// --- save for next frame
-					binDataPrevious[i] = binData[i];
-					peakBinsPrevious[i] = peakBins[i];
-
-				}
-			}// end if peak locking
+			// --- split into magnitude and phase, then find every bin's phase increment
+			getMagnitudesAndPhases(&fftData[0][0], &magnitude[2], phase, PSM_NUM_BINS);
+			advancePhases();
 
+			if (parameters.enablePeakPhaseLocking)
+				propagateLockedPhases();
 			else // ---> old school
-			{
-				for (int i = 0; i < PSM_FFT_LEN; i++)
-				{
-					double mag_k = getMagnitude(fftData[i][0], fftData[i][1]);
-					double phi_k = getPhase(fftData[i][0], fftData[i][1]);
-
-					// --- horizontal phase propagation
-					//
-					// --- omega_k = bin frequency(k)
-					double omega_k = kTwoPi*i / PSM_FFT_LEN;
-
-					// --- phase deviation is actual - expected phase
-					//     = phi_k -(phi(last frame) + wk*ha
-					double phaseDev = phi_k - phi[i] - omega_k*ha;
-
-					// --- unwrapped phase increment
-					double deltaPhi = omega_k*ha + principalArg(phaseDev);
-
-					// --- save for next frame
-					phi[i] = phi_k;
-
-					// --- calculate new phase based on stretch factor; save phase for next time
-					psi[i] = principalArg(psi[i] + deltaPhi * alphaStretchRatio);
-
-					// --- convert back
-					fftData[i][0] = mag_k*cos(psi[i]);
-					fftData[i][1] = mag_k*sin(psi[i]);
-				}
+			{
+				// --- calculate new phase based on stretch factor; save phase for next time
+				for (unsigned int i = 0; i < PSM_NUM_BINS; i++)
+					psi[i] = wrapPhase(psi[i] + deltaPhi[i] * alphaStretchRatio);
 			}
 
+			// --- convert back
+			setMagnitudesAndPhases(&fftData[0][0], &magnitude[2], psi, PSM_NUM_BINS);
 
 			// --- manually so the IFFT (OPTIONAL)
 			vocoder.doInverseFFT();
 
-			// --- can get the iFFT buffers
-			fftw_complex* inv_fftData = vocoder.getIFFTData();
-
-			// --- make copy (can speed this up)
-			double ifft[PSM_FFT_LEN] = { 0.0 };
-			for (int i = 0; i < PSM_FFT_LEN; i++)
-				ifft[i] = inv_fftData[i][0];
+			// --- can get the iFFT buffer; the c2r output is already real
+			double* ifft = vocoder.getIFFTData();
 
 			// --- resample the audio as if it were stretched
-			resample(&ifft[0], outputBuff, PSM_FFT_LEN, outputBufferLength, interpolation::kLinear, windowCorrection, windowBuff);
+			resample(ifft, outputBuff, PSM_FFT_LEN, outputBufferLength, interpolation::kLinear, windowCorrection, windowBuff);
 
-			// --- overlap-add the interpolated buffer to complete the operation
-			vocoder.doOverlapAdd(&outputBuff[0], outputBufferLength);
+			// --- overlap-add the interpolated buffer to complete the operation (plain IFFT until a shift is set)
+			vocoder.doOverlapAdd(outputBufferLength > 0 ? &outputBuff[0] : nullptr, outputBufferLength);
 			}
 
 			return output;
@@ -9543,6 +13332,38 @@ public:
 	}
 
 protected:
+	/** LRU lookup of the Hann window for an output length; a miss recomputes the oldest slot in place */
+	unsigned int getCachedWindow(unsigned int length)
+	{
+		windowCacheClock++;
+
+		unsigned int slot = 0;
+		for (unsigned int i = 0; i < PSM_WINDOW_CACHE_SIZE; i++)
+		{
+			if (windowCacheLength[i] == length)
+			{
+				windowCacheLastUse[i] = windowCacheClock;
+				return i;
+			}
+			if (windowCacheLastUse[i] < windowCacheLastUse[slot])
+				slot = i;
+		}
+
+		// --- miss: evict the least recently used window
+		double* window = &windowCache[slot * PSM_MAX_OUTPUT_LEN];
+		double sum = 0.0;
+		for (unsigned int i = 0; i < length; i++)
+		{
+			window[i] = 0.5 * (1.0 - cos((i*2.0*kPi) / (length)));
+			sum += window[i];
+		}
+		windowCacheCorrection[slot] = 1.0 / sum;
+		windowCacheLength[slot] = length;
+		windowCacheLastUse[slot] = windowCacheClock;
+
+		return slot;
+	}
+
 	PSMVocoderParameters parameters;	///< object parameters
 	PhaseVocoder vocoder;				///< vocoder to perform PSM
 	double alphaStretchRatio = 1.0;		///< alpha stretch ratio = hs/ha
@@ -9550,22 +13371,38 @@ protected:
 	// --- FFT is 4096 with 75% overlap
 	const double hs = PSM_FFT_LEN / 4;	///< hs = N/4 --- 75% overlap
 	double ha = PSM_FFT_LEN / 4;		///< ha = N/4 --- 75% overlap
-	double phi[PSM_FFT_LEN] = { 0.0 };	///< array of phase values for classic algorithm
-	double psi[PSM_FFT_LEN] = { 0.0 };	///< array of phase correction values for classic algorithm
-
-	// --- for peak-locking
-	BinData binData[PSM_FFT_LEN];			///< array of BinData structures for current FFT frame
-	BinData binDataPrevious[PSM_FFT_LEN];	///< array of BinData structures for previous FFT frame
-
-	int peakBins[PSM_FFT_LEN] = { -1 };		///< array of current peak bin index values (-1 = not peak)
-	int peakBinsPrevious[PSM_FFT_LEN] = { -1 }; ///< array of previous peak bin index values (-1 = not peak)
-
-	double* windowBuff = nullptr;			///< buffer for window
-	double* outputBuff = nullptr;			///< buffer for resampled output
+	double phi[PSM_NUM_BINS] = { 0.0 };	///< array of phase values for classic algorithm
+	double psi[PSM_NUM_BINS] = { 0.0 };	///< array of phase correction values for classic algorithm
+
+	// --- per-bin data, one array per quantity so the loops vectorize
+	double magnitude[PSM_NUM_BINS + 4] = { 0.0 };	///< bin magnitudes, starting at [2]; two zero guard bins each side
+	double phase[PSM_NUM_BINS] = { 0.0 };			///< bin phases of the current frame
+	double deltaPhi[PSM_NUM_BINS] = { 0.0 };		///< unwrapped phase increments of the current frame
+
+	// --- for peak-locking and tracking; peak lists are sorted by bin
+	double psiPrevious[PSM_NUM_BINS] = { 0.0 };		///< psi of the previous frame, for tracked peaks
+	int peakBins[PSM_NUM_BINS] = { 0 };				///< current peak bins
+	int peakBinsPrevious[PSM_NUM_BINS] = { 0 };		///< previous frame's peak bins
+	int previousPeakBins[PSM_NUM_BINS] = { 0 };		///< matched previous peak bin for each current peak (-1 = new)
+	unsigned int numPeaks = 0;						///< current peak count
+	unsigned int numPeaksPrevious = 0;				///< previous frame's peak count
+
+	AudioArena arena;						///< one block for the output buffer and the window cache
+	double* windowBuff = nullptr;			///< current window (points into the cache)
+	double* outputBuff = nullptr;			///< buffer for resampled output, PSM_MAX_OUTPUT_LEN
 	double windowCorrection = 0.0;			///< window correction value
 	unsigned int outputBufferLength = 0;	///< lenght of resampled output array
+
+	// --- window cache: PSM_WINDOW_CACHE_SIZE slots of PSM_MAX_OUTPUT_LEN
+	double* windowCache = nullptr;											///< cached windows
+	unsigned int windowCacheLength[PSM_WINDOW_CACHE_SIZE] = { 0 };			///< window length per slot (0 = empty)
+	double windowCacheCorrection[PSM_WINDOW_CACHE_SIZE] = { 0.0 };			///< window correction per slot
+	unsigned int windowCacheLastUse[PSM_WINDOW_CACHE_SIZE] = { 0 };		///< LRU stamp per slot
+	unsigned int windowCacheClock = 0;										///< LRU clock
 };
 
+#endif // HAVE_FFTW
+
 // --- sample rate conversion
 //
 // --- supported conversion ratios - you can EASILY add more to this
@@ -9575,15 +13412,19 @@ protected:
 \brief
 Use this strongly typed enum to easily set up or down sampling ratios.
 
-- enum class rateConversionRatio { k2x, k4x };
+- enum class rateConversionRatio { k2x, k4x, k8x };
 
 \author Will Pirkle http://www.willpirkle.com
 \remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-enum class rateConversionRatio { k2x, k4x };
-const unsigned int maxSamplingRatio = 4;
+enum class rateConversionRatio { k2x, k4x, k8x };
+const unsigned int maxSamplingRatio = 8;
+
+// --- anti-aliasing filter design targets
+const double SRC_PASSBAND_EDGE = 20000.0;		///< protected audio band (Hz); lowered to 0.45 x fs at low rates
+const double SRC_MAX_ATTENUATION_DB = 120.0;	///< stopband attenuation cap for long filters
 
 /**
 @countForRatio
@@ -9598,123 +13439,193 @@ inline unsigned int countForRatio(rateConversionRatio ratio)
 {
 	if (ratio == rateConversionRatio::k2x)
 		return 2;
-	else if (ratio == rateConversionRatio::k4x || ratio == rateConversionRatio::k4x)
+	else if (ratio == rateConversionRatio::k4x)
 		return 4;
+	else if (ratio == rateConversionRatio::k8x)
+		return 8;
 
 	return 0;
 }
 
-// --- get table pointer for built-in anti-aliasing LPFs
 /**
-@getFilterIRTable
+@besselI0
 \ingroup FX-Functions
 
-@brief returns the up or downsample ratio as a numeric value
+@brief zeroth order modified Bessel function of the first kind, for the Kaiser window
 
-\param FIRLength - lenght of FIR
-\param ratio - the conversinon ratio
-\param sampleRate - the sample rate
-\return a pointer to the appropriate FIR coefficient table in filters.h or nullptr if not found
+\param x - argument
+\return I0(x)
 */
-inline double* getFilterIRTable(unsigned int FIRLength, rateConversionRatio ratio, unsigned int sampleRate)
+inline double besselI0(double x)
 {
-	// --- we only have built in filters for 44.1 and 48 kHz
-	if (sampleRate != 44100 && sampleRate != 48000) return nullptr;
-
-	// --- choose 2xtable
-	if (ratio == rateConversionRatio::k2x)
+	// --- power series; converges quickly for the beta range of the Kaiser window
+	double sum = 1.0;
+	double term = 1.0;
+	const double halfX = 0.5 * x;
+	for (int k = 1; k < 50; k++)
 	{
-		if (sampleRate == 44100)
-		{
-			if (FIRLength == 128)
-				return &LPF128_882[0];
-			else if (FIRLength == 256)
-				return &LPF256_882[0];
-			else if (FIRLength == 512)
-				return &LPF512_882[0];
-			else if (FIRLength == 1024)
-				return &LPF1024_882[0];
-		}
-		if (sampleRate == 48000)
-		{
-			if (FIRLength == 128)
-				return &LPF128_96[0];
-			else if (FIRLength == 256)
-				return &LPF256_96[0];
-			else if (FIRLength == 512)
-				return &LPF512_96[0];
-			else if (FIRLength == 1024)
-				return &LPF1024_96[0];
-		}
+		term *= (halfX / k) * (halfX / k);
+		sum += term;
+		if (term < sum * 1.0e-16)
+			break;
 	}
+	return sum;
+}
+
+/**
+@designKaiserLowpass
+\ingroup FX-Functions
+
+@brief designs a linear phase Kaiser-windowed sinc lowpass FIR with unity DC gain
 
-	// --- choose 4xtable
-	if (ratio == rateConversionRatio::k4x)
+\param h - output array of length taps
+\param length - number of taps
+\param cutoff - -6dB frequency as a fraction of the sample rate (0 to 0.5)
+\param beta - Kaiser window beta
+*/
+inline void designKaiserLowpass(double* h, unsigned int length, double cutoff, double beta)
+{
+	const double center = 0.5 * (length - 1);
+	const double i0Beta = besselI0(beta);
+	double sum = 0.0;
+	for (unsigned int n = 0; n < length; n++)
 	{
-		if (sampleRate == 44100)
-		{
-			if (FIRLength == 128)
-				return &LPF128_1764[0];
-			else if (FIRLength == 256)
-				return &LPF256_1764[0];
-			else if (FIRLength == 512)
-				return &LPF512_1764[0];
-			else if (FIRLength == 1024)
-				return &LPF1024_1764[0];
-		}
-		if (sampleRate == 48000)
-		{
-			if (FIRLength == 128)
-				return &LPF128_192[0];
-			else if (FIRLength == 256)
-				return &LPF256_192[0];
-			else if (FIRLength == 512)
-				return &LPF512_192[0];
-			else if (FIRLength == 1024)
-				return &LPF1024_192[0];
-		}
+		const double t = n - center;
+		const double sinc = t == 0.0 ? 2.0 * cutoff : sin(kTwoPi * cutoff * t) / (kPi * t);
+		const double r = center > 0.0 ? t / center : 0.0;
+		const double window = besselI0(beta * sqrt(fmax(0.0, 1.0 - r*r))) / i0Beta;
+		h[n] = sinc * window;
+		sum += h[n];
 	}
-	return nullptr;
+
+	for (unsigned int n = 0; n < length; n++)
+		h[n] /= sum;
 }
 
-// --- get table pointer for built-in anti-aliasing LPFs
 /**
-@decomposeFilter
+@dotProduct
 \ingroup FX-Functions
 
-@brief performs a polyphase decomposition on a big FIR into a set of sub-band FIRs
+@brief sum of a[i] x b[i]; four independent accumulators so the loop vectorizes
+
+\param a - first array
+\param b - second array
+\param count - length of both arrays
+\return the dot product
+*/
+inline double dotProduct(const double* a, const double* b, unsigned int count)
+{
+	double sum0 = 0.0, sum1 = 0.0, sum2 = 0.0, sum3 = 0.0;
+	unsigned int i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		sum0 += a[i] * b[i];
+		sum1 += a[i + 1] * b[i + 1];
+		sum2 += a[i + 2] * b[i + 2];
+		sum3 += a[i + 3] * b[i + 3];
+	}
+	for (; i < count; i++)
+		sum0 += a[i] * b[i];
+
+	return (sum0 + sum1) + (sum2 + sum3);
+}
+
+/**
+\class SRCFilterCache
+\ingroup FX-Objects
+\brief
+The SRCFilterCache designs and caches the anti-aliasing FIRs for the Interpolator and Decimator at any sample rate.
+
+- one Kaiser-windowed sinc per (sample rate, ratio, length), designed on first request and shared by every object
+- the passband runs to SRC_PASSBAND_EDGE (or 0.45 x fs at low rates); the stopband starts where aliases and images
+  would land back in that passband (fs - passband edge), so the whole transition band is used
+- the Kaiser beta is chosen for the attenuation the length can reach across that band (capped at SRC_MAX_ATTENUATION_DB);
+  short filters at high ratios trade attenuation for length
+- designing is serialized on a mutex; filters live until the process exits
+
+Control I/F:
+- getFilter( ) may design, so call it from initialization code.
 
-\param filterIR - pointer to filter IR array
-\param FIRLength - lenght of IR array
-\param ratio - up or down sampling ratio
-\return a pointer an arry of buffer pointers to the decomposed mini-filters
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
 */
-inline double** decomposeFilter(double* filterIR, unsigned int FIRLength, unsigned int ratio)
+class SRCFilterCache
 {
-	unsigned int subBandLength = FIRLength / ratio;
-	double ** polyFilterSet = new double*[ratio];
-	for (unsigned int i = 0; i < ratio; i++)
+public:
+	/** the one cache */
+	static SRCFilterCache& getInstance()
 	{
-		double* polyFilter = new double[subBandLength];
-		polyFilterSet[i] = polyFilter;
+		static SRCFilterCache cache;
+		return cache;
 	}
 
-	int m = 0;
-	for (int i = 0; i < subBandLength; i++)
+	/** get (designing if needed) the filter for a rate, ratio and length; nullptr for an unsupported ratio */
+	const double* getFilter(unsigned int FIRLength, rateConversionRatio ratio, unsigned int sampleRate)
 	{
-		for (int j = ratio - 1; j >= 0; j--)
+		const unsigned int count = countForRatio(ratio);
+		if (count == 0 || FIRLength < count || sampleRate == 0)
+			return nullptr;
+
+		const unsigned long long key = ((unsigned long long)sampleRate << 32) | ((unsigned long long)FIRLength << 4) | count;
+
+		std::lock_guard<std::mutex> lock(cacheMutex);
+		std::vector<double>& filter = filters[key];
+		if (filter.empty())
 		{
-			double* polyFilter = polyFilterSet[j];
-			polyFilter[i] = filterIR[m++];
+			filter.resize(FIRLength);
+
+			// --- edges as fractions of the oversampled rate
+			const double oversampledRate = (double)sampleRate * count;
+			const double passEdge = fmin(SRC_PASSBAND_EDGE, 0.45 * sampleRate);
+			const double stopEdge = sampleRate - passEdge;
+			const double cutoff = 0.5 * (passEdge + stopEdge) / oversampledRate;
+			const double transition = kTwoPi * (stopEdge - passEdge) / oversampledRate;
+
+			// --- Kaiser's estimates: attenuation for this length and transition, then beta
+			double attenuation = 2.285 * transition * (FIRLength - 1) + 7.95;
+			attenuation = fmin(attenuation, SRC_MAX_ATTENUATION_DB);
+			double beta = 0.0;
+			if (attenuation > 50.0)
+				beta = 0.1102 * (attenuation - 8.7);
+			else if (attenuation >= 21.0)
+				beta = 0.5842 * pow(attenuation - 21.0, 0.4) + 0.07886 * (attenuation - 21.0);
+
+			designKaiserLowpass(filter.data(), FIRLength, cutoff, beta);
 		}
+
+		return filter.data();
 	}
 
-	return polyFilterSet;
+private:
+	SRCFilterCache() {}
+	SRCFilterCache(const SRCFilterCache&) = delete;
+	SRCFilterCache& operator=(const SRCFilterCache&) = delete;
+
+	std::mutex cacheMutex;										///< serializes design
+	std::map<unsigned long long, std::vector<double>> filters;	///< (rate, length, ratio) -> taps
+};
+
+// --- get table pointer for built-in anti-aliasing LPFs
+/**
+@getFilterIRTable
+\ingroup FX-Functions
+
+@brief returns the anti-aliasing LPF for a conversion; designed at run time (and cached) for any sample rate
+
+\param FIRLength - lenght of FIR
+\param ratio - the conversinon ratio
+\param sampleRate - the sample rate
+\return a pointer to the FIR coefficients (owned by the SRCFilterCache) or nullptr for an unsupported ratio
+*/
+inline const double* getFilterIRTable(unsigned int FIRLength, rateConversionRatio ratio, unsigned int sampleRate)
+{
+	return SRCFilterCache::getInstance().getFilter(FIRLength, ratio, sampleRate);
 }
 
 /**
 \struct InterpolatorOutput
-\ingroup FFTW-Objects
+\ingroup FX-Objects
 \brief
 Custom output structure for interpolator; it holds an arry of interpolated output samples.
 
@@ -9733,10 +13644,14 @@ struct InterpolatorOutput
 
 /**
 \class Interpolator
-\ingroup FFTW-Objects
+\ingroup FX-Objects
 \brief
 The Interpolator object implements a sample rate interpolator. One input sample yields N output samples.
 
+- the anti-aliasing filter is designed for the actual sample rate (see SRCFilterCache), so every rate works
+- polyphase direct form: each output phase is one short dot product against a shared, mirrored input history,
+  so there is no block latency beyond the filter's own group delay and no FFT cost
+
 Audio I/O:
 - Processes mono input to interpoalted (multi-sample) output.
 
@@ -9759,7 +13674,7 @@ public:
 	\param _FIRLength the interpolator's anti-aliasing filter length
 	\param _ratio the conversion ratio (see rateConversionRatio)
 	\param _sampleRate the actual sample rate
-	\param _polyphase flag to enable polyphase decomposition
+	\param _polyphase kept for compatibility; the filter always runs in polyphase form
 	*/
 	inline void initialize(unsigned int _FIRLength, rateConversionRatio _ratio, unsigned int _sampleRate, bool _polyphase = true)
 	{
@@ -9767,79 +13682,99 @@ public:
 		sampleRate = _sampleRate;
 		FIRLength = _FIRLength;
 		ratio = _ratio;
-		unsigned int count = countForRatio(ratio);
-		unsigned int subBandLength = FIRLength / count;
-
-		// --- straight SRC, no polyphase
-		convolver.initialize(FIRLength);
-
-		// --- set filterIR from built-in set - user can always override this!
-		double* filterTable = getFilterIRTable(FIRLength, ratio, sampleRate);
-		if (!filterTable) return;
-		convolver.setFilterIR(filterTable);
-
-		if (!polyphase) return;
+		count = countForRatio(ratio);
+		subBandLength = count > 0 ? (FIRLength + count - 1) / count : 0;
 
-		// --- decompose filter
-		double** polyPhaseFilters = decomposeFilter(filterTable, FIRLength, count);
-		if (!polyPhaseFilters)
+		const double* filterTable = getFilterIRTable(FIRLength, ratio, sampleRate);
+		if (!filterTable || subBandLength == 0)
 		{
-			polyphase = false;
+			count = 0;
 			return;
 		}
 
-		// --- set the individual polyphase filter IRs on the convolvers
-		for (unsigned int i = 0; i < count; i++)
+		// --- phase filters and history are one zeroed arena block
+		arena.prepare(AudioArena::getAllocationSize<double>(count * subBandLength) +
+					  AudioArena::getAllocationSize<double>(subBandLength * 2));
+
+		// --- decompose: phase p gets h[k*count + p], stored reversed to run forward over the history
+		phaseFilters = arena.allocate<double>(count * subBandLength);
+		for (unsigned int p = 0; p < count; p++)
 		{
-			polyPhaseConvolvers[i].initialize(subBandLength);
-			polyPhaseConvolvers[i].setFilterIR(polyPhaseFilters[i]);
-			delete[] polyPhaseFilters[i];
+			for (unsigned int k = 0; k < subBandLength; k++)
+			{
+				unsigned int tap = k * count + p;
+				phaseFilters[p * subBandLength + (subBandLength - 1 - k)] = tap < FIRLength ? filterTable[tap] : 0.0;
+			}
 		}
 
-		delete[] polyPhaseFilters;
+		history = arena.allocate<double>(subBandLength * 2);
+		reset();
+	}
+
+	/** clear the filter history */
+	void reset()
+	{
+		if (history)
+			memset(&history[0], 0, sizeof(double) * subBandLength * 2);
+		historyIndex = 0;
 	}
 
 	/** perform the interpolation; the multiple outputs are in an array in the return structure */
 	inline InterpolatorOutput interpolateAudio(double xn)
 	{
-		unsigned int count = countForRatio(ratio);
-
 		// --- setup output
 		InterpolatorOutput output;
 		output.count = count;
+		if (count == 0)
+			return output;
+
+		// --- mirrored history: the last subBandLength inputs are always contiguous
+		history[historyIndex] = xn;
+		history[historyIndex + subBandLength] = xn;
+		historyIndex = historyIndex + 1 == subBandLength ? 0 : historyIndex + 1;
+		const double* x = &history[historyIndex];
 
 		// --- interpolators need the amp correction
-		double ampCorrection = double(count);
+		const double ampCorrection = double(count);
 
-		// --- polyphase uses "backwards" indexing for interpolator; see book
-		int m = count-1;
-		for (unsigned int i = 0; i < count; i++)
+		for (unsigned int p = 0; p < count; p++)
+			output.audioData[p] = ampCorrection * dotProduct(&phaseFilters[p * subBandLength], x, subBandLength);
+
+		return output;
+	}
+
+	/** interpolate a block of inputs into count x numSamples outputs */
+	inline void interpolateAudioBlock(const double* input, double* output, unsigned int numSamples)
+	{
+		for (unsigned int n = 0; n < numSamples; n++)
 		{
-			if (!polyphase)
-				output.audioData[i] = i == 0 ? ampCorrection*convolver.processAudioSample(xn) : ampCorrection*convolver.processAudioSample(0.0);
-			else
-				output.audioData[i] = ampCorrection*polyPhaseConvolvers[m--].processAudioSample(xn);
+			InterpolatorOutput out = interpolateAudio(input[n]);
+			for (unsigned int p = 0; p < out.count; p++)
+				output[n * out.count + p] = out.audioData[p];
 		}
-		return output;
 	}
 
-protected:
-	// --- for straight, non-polyphase
-	FastConvolver convolver; ///< the convolver
+	/** get the filter latency in output (oversampled) samples */
+	unsigned int getLatency() { return FIRLength > 0 ? (FIRLength - 1) / 2 : 0; }
 
+protected:
 	// --- we save these for future expansion, currently only sparsely used
 	unsigned int sampleRate = 44100;	///< sample rate
 	unsigned int FIRLength = 256;		///< FIR length
 	rateConversionRatio ratio = rateConversionRatio::k2x; ///< conversion ration
-
-	// --- polyphase: 4x is max right now
-	bool polyphase = true;									///< enable polyphase decomposition
-	FastConvolver polyPhaseConvolvers[maxSamplingRatio];	///< a set of sub-band convolvers for polyphase operation
+	bool polyphase = true;				///< kept for compatibility
+
+	unsigned int count = 0;							///< conversion ratio as a number; 0 = not initialized
+	unsigned int subBandLength = 0;					///< taps per phase
+	AudioArena arena;								///< one block for the phase filters and the history
+	double* phaseFilters = nullptr;					///< count x subBandLength, reversed
+	double* history = nullptr;						///< mirrored input history, 2 x subBandLength
+	unsigned int historyIndex = 0;					///< history write index
 };
 
 /**
 \struct DecimatorInput
-\ingroup FFTW-Objects
+\ingroup FX-Objects
 \brief
 Custom input structure for DecimatorInput; it holds an arry of input samples that will be decimated down to just one sample.
 
@@ -9857,11 +13792,15 @@ struct DecimatorInput
 
 /**
 \class Decimator
-\ingroup FFTW-Objects
+\ingroup FX-Objects
 \brief
 The Decimator object implements a sample rate decimator. Ana array of M input samples is decimated
 to one output sample.
 
+- the anti-aliasing filter is designed for the actual sample rate (see SRCFilterCache), so every rate works
+- polyphase direct form: phase p filters every M-th input (audioData[M - 1 - p]) through its own mirrored history;
+  the M dot products sum to the output, so only 1/M of the full filter runs per input sample
+
 Audio I/O:
 - Processes mono input to interpoalted (multi-sample) output.
 
@@ -9884,7 +13823,7 @@ public:
 	\param _FIRLength the decimator's anti-aliasing filter length
 	\param _ratio the conversion ratio (see rateConversionRatio)
 	\param _sampleRate the actual sample rate
-	\param _polyphase flag to enable polyphase decomposition
+	\param _polyphase kept for compatibility; the filter always runs in polyphase form
 	*/
 	inline void initialize(unsigned int _FIRLength, rateConversionRatio _ratio, unsigned int _sampleRate, bool _polyphase = true)
 	{
@@ -9892,69 +13831,392 @@ public:
 		sampleRate = _sampleRate;
 		FIRLength = _FIRLength;
 		ratio = _ratio;
-		unsigned int count = countForRatio(ratio);
-		unsigned int subBandLength = FIRLength / count;
-
-		// --- straight SRC, no polyphase
-		convolver.initialize(FIRLength);
+		count = countForRatio(ratio);
+		subBandLength = count > 0 ? (FIRLength + count - 1) / count : 0;
 
-		// --- set filterIR from built-in set - user can always override this!
-		double* filterTable = getFilterIRTable(FIRLength, ratio, sampleRate);
-		if (!filterTable) return;
-		convolver.setFilterIR(filterTable);
-
-		if (!polyphase) return;
-
-		// --- decompose filter
-		double** polyPhaseFilters = decomposeFilter(filterTable, FIRLength, count);
-		if (!polyPhaseFilters)
+		const double* filterTable = getFilterIRTable(FIRLength, ratio, sampleRate);
+		if (!filterTable || subBandLength == 0)
 		{
-			polyphase = false;
+			count = 0;
 			return;
 		}
 
-		// --- set the individual polyphase filter IRs on the convolvers
-		for (unsigned int i = 0; i < count; i++)
+		// --- phase filters and histories are one zeroed arena block
+		arena.prepare(AudioArena::getAllocationSize<double>(count * subBandLength) +
+					  AudioArena::getAllocationSize<double>(count * subBandLength * 2));
+
+		// --- decompose: phase p gets h[k*count + p], stored reversed to run forward over the history
+		phaseFilters = arena.allocate<double>(count * subBandLength);
+		for (unsigned int p = 0; p < count; p++)
 		{
-			polyPhaseConvolvers[i].initialize(subBandLength);
-			polyPhaseConvolvers[i].setFilterIR(polyPhaseFilters[i]);
-			delete[] polyPhaseFilters[i];
+			for (unsigned int k = 0; k < subBandLength; k++)
+			{
+				unsigned int tap = k * count + p;
+				phaseFilters[p * subBandLength + (subBandLength - 1 - k)] = tap < FIRLength ? filterTable[tap] : 0.0;
+			}
 		}
 
-		delete[] polyPhaseFilters;
+		// --- one mirrored history per phase
+		history = arena.allocate<double>(count * subBandLength * 2);
+		reset();
+	}
+
+	/** clear the filter histories */
+	void reset()
+	{
+		if (history)
+			memset(&history[0], 0, sizeof(double) * count * subBandLength * 2);
+		historyIndex = 0;
 	}
 
 	/** decimate audio input samples into one outut sample (return value) */
 	inline double decimateAudio(DecimatorInput data)
 	{
-		unsigned int count = countForRatio(ratio);
+		if (count == 0)
+			return 0.0;
 
-		// --- setup output
-		double output = 0.0;
+		const unsigned int nextIndex = historyIndex + 1 == subBandLength ? 0 : historyIndex + 1;
 
-		// --- polyphase uses "forwards" indexing for decimator; see book
-		for (unsigned int i = 0; i < count; i++)
+		// --- audioData[count - 1] is the newest sample; it feeds phase 0
+		double output = 0.0;
+		for (unsigned int p = 0; p < count; p++)
 		{
-			if (!polyphase) // overwrites output; only the last output is saved
-				output = convolver.processAudioSample(data.audioData[i]);
-			else
-				output += polyPhaseConvolvers[i].processAudioSample(data.audioData[i]);
+			double* phaseHistory = &history[p * subBandLength * 2];
+			const double xn = data.audioData[count - 1 - p];
+			phaseHistory[historyIndex] = xn;
+			phaseHistory[historyIndex + subBandLength] = xn;
+
+			output += dotProduct(&phaseFilters[p * subBandLength], &phaseHistory[nextIndex], subBandLength);
 		}
+		historyIndex = nextIndex;
+
 		return output;
 	}
 
-protected:
-	// --- for straight, non-polyphase
-	FastConvolver convolver;		 ///< fast convolver
+	/** decimate count x numSamples inputs into a block of numSamples outputs */
+	inline void decimateAudioBlock(const double* input, double* output, unsigned int numSamples)
+	{
+		DecimatorInput data;
+		data.count = count;
+		for (unsigned int n = 0; n < numSamples; n++)
+		{
+			for (unsigned int p = 0; p < count; p++)
+				data.audioData[p] = input[n * count + p];
+			output[n] = decimateAudio(data);
+		}
+	}
 
+	/** get the filter latency in input (oversampled) samples */
+	unsigned int getLatency() { return FIRLength > 0 ? (FIRLength - 1) / 2 : 0; }
+
+protected:
 	// --- we save these for future expansion, currently only sparsely used
 	unsigned int sampleRate = 44100;	///< sample rate
 	unsigned int FIRLength = 256;		///< FIR length
 	rateConversionRatio ratio = rateConversionRatio::k2x; ///< conversion ration
+	bool polyphase = true;				///< kept for compatibility
+
+	unsigned int count = 0;							///< conversion ratio as a number; 0 = not initialized
+	unsigned int subBandLength = 0;					///< taps per phase
+	AudioArena arena;								///< one block for the phase filters and the histories
+	double* phaseFilters = nullptr;					///< count x subBandLength, reversed
+	double* history = nullptr;						///< count mirrored histories, 2 x subBandLength each
+	unsigned int historyIndex = 0;					///< shared history write index
+};
+
+
+
+// --- IIR halfband oversampling
+const unsigned int HALFBAND_MAX_COEFS = 10;	///< allpass coefficients in the steepest (first) stage
+const unsigned int HALFBAND_MAX_STAGES = 3;	///< 2x, 4x, 8x
+
+/**
+@designHalfbandAllpass
+\ingroup FX-Functions
+
+@brief designs the allpass coefficients of a polyphase IIR halfband filter H(z) = 0.5 x (A0(z^2) + z^-1 A1(z^2)),
+an elliptic-style design after Valenzuela and Constantinides; even coefficients go to A0, odd ones to A1
+
+\param coefs - output array of numCoefs allpass coefficients
+\param numCoefs - number of first order allpass sections (total over both branches)
+\param transition - transition bandwidth as a fraction of the oversampled rate (0 to 0.25); passband ends at 0.25 - transition
+*/
+inline void designHalfbandAllpass(double* coefs, unsigned int numCoefs, double transition)
+{
+	// --- elliptic modulus k and nome q of the transition band
+	double k = tan((1.0 - transition * 2.0) * kPi / 4.0);
+	k *= k;
+	const double kksqrt = pow(1.0 - k * k, 0.25);
+	const double e = 0.5 * (1.0 - kksqrt) / (1.0 + kksqrt);
+	const double e4 = e * e * e * e;
+	const double q = e * (1.0 + e4 * (2.0 + e4 * (15.0 + 150.0 * e4)));
+	const int order = numCoefs * 2 + 1;
+
+	for (unsigned int index = 0; index < numCoefs; index++)
+	{
+		const int c = index + 1;
+
+		// --- theta function series for the pole positions
+		double num = 0.0;
+		double term = 0.0;
+		int sign = 1;
+		for (int i = 0; i == 0 || fabs(term) > 1.0e-100; i++, sign = -sign)
+		{
+			term = pow(q, i * (i + 1)) * sin((i * 2 + 1) * c * kPi / order) * sign;
+			num += term;
+		}
+		num *= pow(q, 0.25);
+
+		double den = 0.0;
+		sign = -1;
+		for (int i = 1; i == 1 || fabs(term) > 1.0e-100; i++, sign = -sign)
+		{
+			term = pow(q, i * i) * cos(i * 2 * c * kPi / order) * sign;
+			den += term;
+		}
+		den += 0.5;
+
+		const double ww = num / den;
+		const double wwsq = ww * ww;
+		const double x = sqrt((1.0 - wwsq * k) * (1.0 - wwsq / k)) / (1.0 + wwsq);
+		coefs[index] = (1.0 - x) / (1.0 + x);
+	}
+}
+
+/**
+\class HalfbandStage
+\ingroup FX-Objects
+\brief
+The HalfbandStage is one 2x polyphase IIR halfband stage (up and down) running numLanes channels in lock step.
+
+- two branches of first order allpass sections, evaluated at the low rate (polyphase), so there is no
+  zero-stuffing and each branch runs at half the high rate
+- state is lane-contiguous ([section][lane]) and the lane loop is innermost, so the compiler vectorizes across channels
+- upsampler and downsampler keep separate state, so one stage serves both sides of a nonlinearity
+
+Control I/F:
+- setCoefficients( ) with a designHalfbandAllpass( ) set; numCoefs must be even.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+template<uint32_t numLanes>
+class HalfbandStage
+{
+public:
+	HalfbandStage() {}		/* C-TOR */
+	~HalfbandStage() {}		/* D-TOR */
+
+	/** load allpass coefficients; numCoefs is rounded down to even and limited to HALFBAND_MAX_COEFS */
+	void setCoefficients(const double* _coefs, unsigned int _numCoefs)
+	{
+		numCoefs = (_numCoefs > HALFBAND_MAX_COEFS ? HALFBAND_MAX_COEFS : _numCoefs) & ~1u;
+		for (unsigned int c = 0; c < numCoefs; c++)
+			coefs[c] = _coefs[c];
+		reset();
+	}
+
+	/** clear both state sets */
+	void reset()
+	{
+		memset(upX, 0, sizeof(upX));
+		memset(upY, 0, sizeof(upY));
+		memset(downX, 0, sizeof(downX));
+		memset(downY, 0, sizeof(downY));
+	}
+
+	/** one low-rate frame in, two high-rate frames out (out0 first) */
+	inline void upsampleFrame(const double* in, double* out0, double* out1)
+	{
+		for (uint32_t l = 0; l < numLanes; l++)
+		{
+			out0[l] = in[l];
+			out1[l] = in[l];
+		}
+		processBranches(out0, out1, upX, upY);
+	}
+
+	/** two high-rate frames in (in0 first), one low-rate frame out */
+	inline void downsampleFrame(const double* in0, const double* in1, double* out)
+	{
+		// --- A0 takes the newer sample, A1 the older: H(z) = 0.5 x (A0(z^2) + z^-1 A1(z^2))
+		double branch0[numLanes];
+		double branch1[numLanes];
+		for (uint32_t l = 0; l < numLanes; l++)
+		{
+			branch0[l] = in1[l];
+			branch1[l] = in0[l];
+		}
+		processBranches(branch0, branch1, downX, downY);
+
+		for (uint32_t l = 0; l < numLanes; l++)
+			out[l] = 0.5 * (branch0[l] + branch1[l]);
+	}
 
-	// --- polyphase: 4x is max right now
-	bool polyphase = true;									///< enable polyphase decomposition
-	FastConvolver polyPhaseConvolvers[maxSamplingRatio];	///< a set of sub-band convolvers for polyphase operation
+protected:
+	/** run both allpass chains in place: even coefficients on s0, odd on s1 */
+	inline void processBranches(double* s0, double* s1, double (*x)[numLanes], double (*y)[numLanes])
+	{
+		for (unsigned int c = 0; c < numCoefs; c += 2)
+		{
+			const double a0 = coefs[c];
+			const double a1 = coefs[c + 1];
+			for (uint32_t l = 0; l < numLanes; l++)
+			{
+				// --- y(n) = a x (x(n) - y(n-1)) + x(n-1), with z^-1 at the low rate = z^-2 at the high rate
+				const double t0 = (s0[l] - y[c][l]) * a0 + x[c][l];
+				const double t1 = (s1[l] - y[c + 1][l]) * a1 + x[c + 1][l];
+				x[c][l] = s0[l];
+				x[c + 1][l] = s1[l];
+				y[c][l] = t0;
+				y[c + 1][l] = t1;
+				s0[l] = t0;
+				s1[l] = t1;
+			}
+		}
+	}
+
+	double coefs[HALFBAND_MAX_COEFS] = { 0.0 };				///< allpass coefficients
+	unsigned int numCoefs = 0;								///< coefficients in use (even)
+	double upX[HALFBAND_MAX_COEFS][numLanes] = { { 0.0 } };		///< upsampler section inputs
+	double upY[HALFBAND_MAX_COEFS][numLanes] = { { 0.0 } };		///< upsampler section outputs
+	double downX[HALFBAND_MAX_COEFS][numLanes] = { { 0.0 } };	///< downsampler section inputs
+	double downY[HALFBAND_MAX_COEFS][numLanes] = { { 0.0 } };	///< downsampler section outputs
 };
 
-#endif
+/**
+\class IIROversampler
+\ingroup FX-Objects
+\brief
+The IIROversampler is a minimum-latency 2x/4x/8x up/down sampler built from cascaded polyphase IIR halfband stages;
+use it around a nonlinearity (saturation, true-peak detection) where the FIR Interpolator/Decimator latency is unwanted.
+
+- stage 1 (the steep one) has 10 coefficients, about 100 dB rejection and a flat passband to 20 kHz at 44.1 kHz;
+  the later stages only have to clear the images of an already band-limited signal, so they are much shorter
+- the phase response is not linear, but the group delay is a few samples at the base rate
+- numLanes channels run in lock step (see HalfbandStage)
+
+Audio I/O:
+- frame or block; blocks are per channel, the oversampled block is getFactor( ) x numSamples long.
+
+Control I/F:
+- initialize( ) with the ratio; reset( ) clears the state.
+
+\author Christian George
+\version Revision : 1.0
+\date Date : 2026 / 10 / 19
+*/
+template<uint32_t numLanes>
+class IIROversampler
+{
+public:
+	IIROversampler() { initialize(rateConversionRatio::k2x); }	/* C-TOR */
+	~IIROversampler() {}										/* D-TOR */
+
+	/** set the ratio; designs the stages */
+	void initialize(rateConversionRatio ratio)
+	{
+		factor = countForRatio(ratio);
+		numStages = factor == 8 ? 3 : (factor == 4 ? 2 : 1);
+		if (factor == 0)
+		{
+			factor = 2;
+			numStages = 1;
+		}
+
+		// --- { coefficients, transition } per stage; each stage's transition band starts where the first stage's passband ends
+		const unsigned int stageCoefs[HALFBAND_MAX_STAGES] = { 10, 6, 4 };
+		const double stageTransition[HALFBAND_MAX_STAGES] = { 0.02, 0.13, 0.19 };
+		for (unsigned int s = 0; s < numStages; s++)
+		{
+			double coefs[HALFBAND_MAX_COEFS] = { 0.0 };
+			designHalfbandAllpass(coefs, stageCoefs[s], stageTransition[s]);
+			stages[s].setCoefficients(coefs, stageCoefs[s]);
+		}
+	}
+
+	/** clear all stages */
+	void reset()
+	{
+		for (unsigned int s = 0; s < HALFBAND_MAX_STAGES; s++)
+			stages[s].reset();
+	}
+
+	/** get the oversampling factor */
+	unsigned int getFactor() { return factor; }
+
+	/** one base-rate frame in, getFactor( ) frames out: out[i][lane] */
+	inline void upsampleFrame(const double* in, double (*out)[numLanes])
+	{
+		// --- fan out stage by stage; frames must reach each stage in time order, so stage via a scratch copy
+		double scratch[maxSamplingRatio / 2][numLanes];
+		for (uint32_t l = 0; l < numLanes; l++)
+			out[0][l] = in[l];
+
+		unsigned int count = 1;
+		for (unsigned int s = 0; s < numStages; s++)
+		{
+			memcpy(scratch, out, count * sizeof(scratch[0]));
+			for (unsigned int i = 0; i < count; i++)
+				stages[s].upsampleFrame(scratch[i], out[2 * i], out[2 * i + 1]);
+			count *= 2;
+		}
+	}
+
+	/** getFactor( ) frames in: in[i][lane], one base-rate frame out; in is used as scratch */
+	inline void downsampleFrame(double (*in)[numLanes], double* out)
+	{
+		unsigned int count = factor;
+		for (int s = numStages - 1; s >= 0; s--)
+		{
+			count /= 2;
+			for (unsigned int i = 0; i < count; i++)
+				stages[s].downsampleFrame(in[2 * i], in[2 * i + 1], in[i]);
+		}
+
+		for (uint32_t l = 0; l < numLanes; l++)
+			out[l] = in[0][l];
+	}
+
+	/** upsample numSamples per channel into getFactor( ) x numSamples per channel */
+	void upsampleBlock(const double* const* input, double* const* output, unsigned int numSamples)
+	{
+		double frame[numLanes];
+		double frames[maxSamplingRatio][numLanes];
+		for (unsigned int n = 0; n < numSamples; n++)
+		{
+			for (uint32_t l = 0; l < numLanes; l++)
+				frame[l] = input[l][n];
+
+			upsampleFrame(frame, frames);
+
+			for (unsigned int i = 0; i < factor; i++)
+				for (uint32_t l = 0; l < numLanes; l++)
+					output[l][n * factor + i] = frames[i][l];
+		}
+	}
+
+	/** downsample getFactor( ) x numSamples per channel into numSamples per channel */
+	void downsampleBlock(const double* const* input, double* const* output, unsigned int numSamples)
+	{
+		double frame[numLanes];
+		double frames[maxSamplingRatio][numLanes];
+		for (unsigned int n = 0; n < numSamples; n++)
+		{
+			for (unsigned int i = 0; i < factor; i++)
+				for (uint32_t l = 0; l < numLanes; l++)
+					frames[i][l] = input[l][n * factor + i];
+
+			downsampleFrame(frames, frame);
+
+			for (uint32_t l = 0; l < numLanes; l++)
+				output[l][n] = frame[l];
+		}
+	}
+
+protected:
+	HalfbandStage<numLanes> stages[HALFBAND_MAX_STAGES];	///< 2x stages, steepest first
+	unsigned int factor = 2;								///< oversampling factor
+	unsigned int numStages = 1;								///< stages in use
+};